@@ -0,0 +1,365 @@
+// Throughput and latency benchmark for every channel variant.
+//
+// Build (from the repository root):
+//   g++ -std=c++23 -O2 -Iinclude bench/main.cpp -o bench -pthread
+//
+// Add `-DCHAN_REPLACE_SEMAPHORE_WITH_CONDITION_VARIABLE` to measure the
+// condition variable semaphore instead of `std::counting_semaphore`.
+//
+// Usage:
+//   bench [--producers=N] [--consumers=N] [--items=N] [--item-size=N]
+//         [--capacity=N] [--chunk-size=N] [FILTER...] [-FILTER...]
+//
+// Filters select variants by name the same way the test runner selects tests:
+// `bench mpsc mpmc -unbuffered` runs the mpsc and mpmc variants except the
+// unbuffered ones.
+//
+// Every broadcast receiver gets every item, so its msgs/sec counts each item
+// once per consumer.
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <latch>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <chan/broadcast/bounded/channel.hpp>
+#include <chan/mpmc/bounded/channel.hpp>
+#include <chan/mpmc/unbounded/channel.hpp>
+#include <chan/mpmc/unbuffered/channel.hpp>
+#include <chan/mpsc/bounded/channel.hpp>
+#include <chan/mpsc/unbounded/channel.hpp>
+#include <chan/mpsc/unbuffered/channel.hpp>
+#include <chan/spmc/bounded/channel.hpp>
+#include <chan/spmc/unbounded/channel.hpp>
+#include <chan/spmc/unbuffered/channel.hpp>
+#include <chan/spsc/bounded/channel.hpp>
+#include <chan/spsc/unbounded/channel.hpp>
+#include <chan/spsc/unbuffered/channel.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+/// Item sent through the channels. `SIZE` is the total size in bytes.
+template <std::size_t SIZE> struct Payload {
+  Clock::time_point sent_at;
+  std::byte padding[SIZE - sizeof(Clock::time_point)];
+};
+
+template <> struct Payload<sizeof(Clock::time_point)> {
+  Clock::time_point sent_at;
+};
+
+struct Options {
+  std::size_t producers = 1;
+  std::size_t consumers = 1;
+  std::size_t items = 1'000'000;
+  std::size_t item_size = 8;
+  std::size_t capacity = 1024;
+  std::size_t chunk_size = 32;
+};
+
+struct Result {
+  std::size_t producers;
+  std::size_t consumers;
+  std::chrono::duration<double> elapsed;
+  std::vector<std::int64_t> latencies;
+};
+
+template <typename S, typename R>
+Result run(S tx, R rx, std::size_t producers, std::size_t consumers,
+           std::size_t items) {
+  std::vector<S> senders;
+  senders.push_back(std::move(tx));
+  if constexpr (std::copyable<S>) {
+    for (std::size_t i = 1; i < producers; ++i) {
+      senders.push_back(senders.front());
+    }
+  }
+
+  std::vector<R> receivers;
+  receivers.push_back(std::move(rx));
+  if constexpr (std::copyable<R>) {
+    for (std::size_t i = 1; i < consumers; ++i) {
+      receivers.push_back(receivers.front());
+    }
+  }
+
+  // Each thread records when it starts and finishes, since threads may run
+  // before or after the main thread is scheduled again.
+  auto thread_count = senders.size() + receivers.size();
+  std::latch start(static_cast<std::ptrdiff_t>(thread_count));
+  std::vector<Clock::time_point> started(thread_count);
+  std::vector<Clock::time_point> finished(thread_count);
+  std::vector<std::vector<std::int64_t>> latencies(receivers.size());
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < senders.size(); ++i) {
+    auto count = items / senders.size() + (i < items % senders.size());
+    threads.emplace_back([tx = std::move(senders[i]), count, &start,
+                          &started = started[i], &finished = finished[i]] {
+      start.arrive_and_wait();
+      started = Clock::now();
+      for (std::size_t j = 0; j < count; ++j) {
+        typename S::Item item{};
+        item.sent_at = Clock::now();
+        if (!tx.send(std::move(item))) {
+          break;
+        }
+      }
+      finished = Clock::now();
+    });
+  }
+
+  for (std::size_t i = 0; i < receivers.size(); ++i) {
+    latencies[i].reserve(items / receivers.size());
+    threads.emplace_back([rx = std::move(receivers[i]),
+                          &latencies = latencies[i], &start,
+                          &started = started[senders.size() + i],
+                          &finished = finished[senders.size() + i]] mutable {
+      start.arrive_and_wait();
+      started = Clock::now();
+      for (const auto &item : rx) {
+        latencies.push_back((Clock::now() - item.sent_at).count());
+      }
+      finished = Clock::now();
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto elapsed = std::ranges::max(finished) - std::ranges::min(started);
+
+  Result result{senders.size(), receivers.size(), elapsed, {}};
+  result.latencies.reserve(items);
+  for (auto &l : latencies) {
+    result.latencies.insert(result.latencies.end(), l.begin(), l.end());
+  }
+  return result;
+}
+
+template <typename F, typename Item>
+Result dispatch_chunk_size(const Options &options) {
+  switch (options.chunk_size) {
+  case 1:
+    return F().template operator()<Item, 1>(options);
+  case 8:
+    return F().template operator()<Item, 8>(options);
+  case 32:
+    return F().template operator()<Item, 32>(options);
+  case 128:
+    return F().template operator()<Item, 128>(options);
+  case 1024:
+    return F().template operator()<Item, 1024>(options);
+  default:
+    throw std::runtime_error("unsupported chunk size (use 1, 8, 32, 128 or "
+                             "1024)");
+  }
+}
+
+template <typename F> Result dispatch_item_size(const Options &options) {
+  switch (options.item_size) {
+  case 8:
+    return dispatch_chunk_size<F, Payload<8>>(options);
+  case 64:
+    return dispatch_chunk_size<F, Payload<64>>(options);
+  case 256:
+    return dispatch_chunk_size<F, Payload<256>>(options);
+  case 1024:
+    return dispatch_chunk_size<F, Payload<1024>>(options);
+  default:
+    throw std::runtime_error("unsupported item size (use 8, 64, 256 or 1024)");
+  }
+}
+
+/// Turn a lambda templated on the item type and chunk size into a function
+/// that picks both from the runtime options.
+template <typename F> auto dispatch(F) -> Result (*)(const Options &) {
+  return dispatch_item_size<F>;
+}
+
+struct Variant {
+  std::string_view name;
+  Result (*func)(const Options &);
+};
+
+// clang-format off
+const Variant VARIANTS[] = {
+    Variant{"spsc_bounded", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::spsc::bounded::channel<I>(o.capacity);
+      return run(std::move(tx), std::move(rx), 1, 1, o.items);
+    })},
+    Variant{"spsc_unbounded", dispatch([]<typename I, std::size_t C>(const Options &o) {
+      auto [tx, rx] = chan::spsc::unbounded::channel<I, C>();
+      return run(std::move(tx), std::move(rx), 1, 1, o.items);
+    })},
+    Variant{"spsc_unbuffered", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::spsc::unbuffered::channel<I>();
+      return run(std::move(tx), std::move(rx), 1, 1, o.items);
+    })},
+    Variant{"mpsc_bounded", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::mpsc::bounded::channel<I>(o.capacity);
+      return run(std::move(tx), std::move(rx), o.producers, 1, o.items);
+    })},
+    Variant{"mpsc_unbounded", dispatch([]<typename I, std::size_t C>(const Options &o) {
+      auto [tx, rx] = chan::mpsc::unbounded::channel<I, C>();
+      return run(std::move(tx), std::move(rx), o.producers, 1, o.items);
+    })},
+    Variant{"mpsc_unbuffered", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::mpsc::unbuffered::channel<I>();
+      return run(std::move(tx), std::move(rx), o.producers, 1, o.items);
+    })},
+    Variant{"spmc_bounded", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::spmc::bounded::channel<I>(o.capacity);
+      return run(std::move(tx), std::move(rx), 1, o.consumers, o.items);
+    })},
+    Variant{"spmc_unbounded", dispatch([]<typename I, std::size_t C>(const Options &o) {
+      auto [tx, rx] = chan::spmc::unbounded::channel<I, C>();
+      return run(std::move(tx), std::move(rx), 1, o.consumers, o.items);
+    })},
+    Variant{"spmc_unbuffered", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::spmc::unbuffered::channel<I>();
+      return run(std::move(tx), std::move(rx), 1, o.consumers, o.items);
+    })},
+    Variant{"mpmc_bounded", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::mpmc::bounded::channel<I>(o.capacity);
+      return run(std::move(tx), std::move(rx), o.producers, o.consumers, o.items);
+    })},
+    Variant{"mpmc_unbounded", dispatch([]<typename I, std::size_t C>(const Options &o) {
+      auto [tx, rx] = chan::mpmc::unbounded::channel<I, C>();
+      return run(std::move(tx), std::move(rx), o.producers, o.consumers, o.items);
+    })},
+    Variant{"mpmc_unbuffered", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::mpmc::unbuffered::channel<I>();
+      return run(std::move(tx), std::move(rx), o.producers, o.consumers, o.items);
+    })},
+    Variant{"broadcast_bounded", dispatch([]<typename I, std::size_t>(const Options &o) {
+      auto [tx, rx] = chan::broadcast::bounded::channel<I>(o.capacity);
+      return run(std::move(tx), std::move(rx), 1, o.consumers, o.items);
+    })},
+};
+// clang-format on
+
+std::int64_t percentile(std::vector<std::int64_t> &latencies, double p) {
+  if (latencies.empty()) {
+    return 0;
+  }
+  auto index = std::min(latencies.size() - 1,
+                        std::size_t(p * double(latencies.size())));
+  std::nth_element(latencies.begin(), latencies.begin() + index,
+                   latencies.end());
+  return latencies[index];
+}
+
+std::string format_latency(std::int64_t nanoseconds) {
+  std::ostringstream os;
+  if (nanoseconds < 10'000) {
+    os << nanoseconds << "ns";
+  } else if (nanoseconds < 10'000'000) {
+    os << nanoseconds / 1'000 << "us";
+  } else {
+    os << nanoseconds / 1'000'000 << "ms";
+  }
+  return std::move(os).str();
+}
+
+bool parse_option(std::string_view arg, std::string_view name,
+                  std::size_t &value) {
+  if (!arg.starts_with(name) || arg.size() <= name.size() ||
+      arg[name.size()] != '=') {
+    return false;
+  }
+  arg.remove_prefix(name.size() + 1);
+  auto [end, error] = std::from_chars(arg.data(), arg.data() + arg.size(), value);
+  if (error != std::errc() || end != arg.data() + arg.size() || value == 0) {
+    std::ostringstream os;
+    os << "invalid value for " << name << ": " << arg;
+    throw std::runtime_error(std::move(os).str());
+  }
+  return true;
+}
+
+int main(int argc, char **argv) try {
+  Options options;
+  std::vector<std::string_view> filters;
+  for (int i = 1; i < argc; ++i) {
+    auto arg = std::string_view(argv[i]);
+    if (arg.starts_with("--")) {
+      if (!parse_option(arg, "--producers", options.producers) &&
+          !parse_option(arg, "--consumers", options.consumers) &&
+          !parse_option(arg, "--items", options.items) &&
+          !parse_option(arg, "--item-size", options.item_size) &&
+          !parse_option(arg, "--capacity", options.capacity) &&
+          !parse_option(arg, "--chunk-size", options.chunk_size)) {
+        std::ostringstream os;
+        os << "unknown option " << arg;
+        throw std::runtime_error(std::move(os).str());
+      }
+    } else {
+      filters.push_back(arg);
+    }
+  }
+
+#if defined(CHAN_USE_FUTEX_SEMAPHORE)
+  std::cout << "semaphore:  FutexSemaphore\n";
+#elif defined(CHAN_REPLACE_SEMAPHORE_WITH_CONDITION_VARIABLE)
+  std::cout << "semaphore:  CvarSemaphore\n";
+#else
+  std::cout << "semaphore:  std::counting_semaphore\n";
+#endif
+  std::cout << "items:      " << options.items << '\n'
+            << "item size:  " << options.item_size << '\n'
+            << "capacity:   " << options.capacity << '\n'
+            << "chunk size: " << options.chunk_size << "\n\n";
+
+  std::cout << std::left << std::setw(18) << "variant" << std::right
+            << std::setw(4) << "P" << std::setw(4) << "C" << std::setw(14)
+            << "msgs/sec" << std::setw(10) << "p50" << std::setw(10) << "p99"
+            << std::setw(10) << "p99.9" << '\n';
+
+  for (const auto &[name, func] : VARIANTS) {
+    bool should_run;
+    if (!filters.empty()) {
+      should_run = filters.front().starts_with('-');
+      for (auto filter : filters) {
+        if (filter.starts_with('-')) {
+          filter.remove_prefix(1);
+          if (name.contains(filter)) {
+            should_run = false;
+          }
+        } else if (name.contains(filter)) {
+          should_run = true;
+        }
+      }
+    } else {
+      should_run = true;
+    }
+
+    if (should_run) {
+      auto result = func(options);
+      auto throughput =
+          double(result.latencies.size()) / result.elapsed.count();
+      std::cout << std::left << std::setw(18) << name << std::right
+                << std::setw(4) << result.producers << std::setw(4)
+                << result.consumers << std::setw(14) << std::fixed
+                << std::setprecision(0) << throughput << std::setw(10)
+                << format_latency(percentile(result.latencies, 0.5))
+                << std::setw(10)
+                << format_latency(percentile(result.latencies, 0.99))
+                << std::setw(10)
+                << format_latency(percentile(result.latencies, 0.999))
+                << std::endl;
+    }
+  }
+  return 0;
+} catch (const std::exception &e) {
+  std::cerr << "error: " << e.what() << '\n';
+  return 1;
+}
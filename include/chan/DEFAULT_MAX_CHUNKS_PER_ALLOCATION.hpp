@@ -0,0 +1,11 @@
+#ifndef _CHAN_DEFAULT_MAX_CHUNKS_PER_ALLOCATION_H
+#define _CHAN_DEFAULT_MAX_CHUNKS_PER_ALLOCATION_H
+
+#include <cstddef>
+
+namespace chan {
+/// Default limit on how many chunks an unbounded channel allocates at once.
+inline constexpr std::size_t DEFAULT_MAX_CHUNKS_PER_ALLOCATION = 64;
+} // namespace chan
+
+#endif
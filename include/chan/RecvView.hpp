@@ -0,0 +1,92 @@
+#ifndef _CHAN_RECV_VIEW_H
+#define _CHAN_RECV_VIEW_H
+
+#include <cassert>
+#include <utility>
+
+namespace chan {
+/// Item in a channel's storage, returned by `Receiver::peek` (or by
+/// `Receiver::recv` on byte channels), that is read in place instead of being
+/// moved out of the channel.
+///
+/// The item stays in the channel, and its slot stays taken, until `release` is
+/// called or the `RecvView` is destroyed. On broadcast channels, the view
+/// holds a `const` item, and releasing it moves the `Receiver` past the item
+/// while it stays in the channel for the other receivers.
+///
+/// # Safety
+/// Do not let a `RecvView` outlive the `Receiver` that returned it, and do not
+/// receive or peek with that `Receiver` until the view is released.
+template <typename T, typename C> class RecvView {
+  C *channel;
+  C::Slot slot;
+
+public:
+  /// Create a `RecvView` for a received slot.
+  ///
+  /// This constructor should not be called directly. Instead, call
+  /// `Receiver::peek`.
+  RecvView(C *channel, C::Slot slot) : channel(channel), slot(slot) {}
+
+  /// Create a null `RecvView`.
+  RecvView() : channel(nullptr), slot() {}
+
+  ~RecvView() { this->release(); }
+
+  RecvView(RecvView &&other)
+      : channel(std::exchange(other.channel, nullptr)), slot(other.slot) {}
+
+  RecvView &operator=(RecvView &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::exchange(other.channel, nullptr);
+      this->slot = other.slot;
+    }
+    return *this;
+  }
+
+  RecvView(const RecvView &) = delete;
+  RecvView &operator=(const RecvView &) = delete;
+
+  /// Return `true` if `this` does not hold an item.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// The item.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  T *get() const {
+    assert(this->channel != nullptr);
+    return C::slot_item(this->slot);
+  }
+
+  /// The item.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  T &operator*() const { return *this->get(); }
+
+  /// The item.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  T *operator->() const { return this->get(); }
+
+  /// Destroy the item and free its slot for senders.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// release the item.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void release() {
+    if (this->channel != nullptr) {
+      std::exchange(this->channel, nullptr)->release_slot(this->slot);
+    }
+  }
+};
+} // namespace chan
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef _CHAN_SELECT_H
+#define _CHAN_SELECT_H
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "RecvError.hpp"
+#include "SendError.hpp"
+#include "detail/ThreadWaker.hpp"
+#include "detail/WakerList.hpp"
+
+namespace chan {
+/// Wait on several send and receive operations at once and complete the first
+/// one that is ready, like Go's `select` statement.
+///
+/// Operations can be added for the `Sender`s and `Receiver`s of any mix of
+/// channel types. Each one takes a callback that is called with the result
+/// when the operation completes. `wait` blocks until an operation completes,
+/// `wait_for` and `wait_until` give up after a timeout, and `try_wait` only
+/// completes an operation that is ready right away, like a `default` case.
+///
+/// Every call completes at most one operation, and returns the index that
+/// `recv` or `send` returned when adding it. Ready operations are tried in
+/// turn, starting after the one that completed last.
+///
+/// A send operation completes at most once. Later calls skip it.
+///
+/// Send operations on unbounded channels are always ready.
+///
+/// A `Select` does not block like a `send` or `recv` call does, so on
+/// unbuffered channels it only completes an operation when the other side is
+/// blocked in a `send` or `recv` call of its own. A `Select` sending on an
+/// unbuffered channel never pairs with a `Select` receiving from it.
+///
+/// # Safety
+/// The `Sender`s and `Receiver`s must outlive the `Select` and must not be
+/// null. Do not share a `Select` between threads.
+class Select {
+  struct Operation {
+    /// Wakers of the channel side the operation waits on, or `nullptr` if the
+    /// operation is always ready.
+    detail::WakerList *wakers;
+
+    /// Try to complete the operation without blocking and call its callback
+    /// if it completed.
+    std::move_only_function<bool()> attempt;
+  };
+
+  std::vector<Operation> operations;
+  std::size_t next_index;
+
+public:
+  Select() : next_index(0) {}
+
+  /// Add an operation that receives an item from `receiver`.
+  ///
+  /// When it completes, `on_recv` is called with what `receiver.recv()` would
+  /// have returned.
+  ///
+  /// Returns the index of the operation.
+  template <typename R, typename F>
+    requires std::invocable<F &, std::expected<typename R::Item, RecvError>>
+  std::size_t recv(const R &receiver, F on_recv) {
+    using T = R::Item;
+    this->operations.push_back({
+        &receiver.wakers(),
+        [&receiver, on_recv = std::move(on_recv)]() mutable {
+          auto item = receiver.try_recv();
+          if (item) {
+            on_recv(std::expected<T, RecvError>(std::move(*item)));
+          } else if (item.error().is_disconnected()) {
+            on_recv(std::expected<T, RecvError>(std::unexpected(RecvError{})));
+          } else {
+            return false;
+          }
+          return true;
+        },
+    });
+    return this->operations.size() - 1;
+  }
+
+  /// Add an operation that sends `item` on `sender`.
+  ///
+  /// When it completes, `on_send` is called with what `sender.send(item)`
+  /// would have returned.
+  ///
+  /// Returns the index of the operation.
+  template <typename S, typename F>
+    requires std::invocable<F &,
+                            std::expected<void, SendError<typename S::Item>>>
+  std::size_t send(const S &sender, typename S::Item item, F on_send) {
+    using T = S::Item;
+    if constexpr (requires { sender.try_send(std::move(item)); }) {
+      this->operations.push_back({
+          &sender.wakers(),
+          [&sender, item = std::optional<T>(std::move(item)),
+           on_send = std::move(on_send)]() mutable {
+            if (!item) {
+              return false;
+            }
+            auto sent = sender.try_send(std::move(*item));
+            item.reset();
+            if (sent) {
+              on_send(std::expected<void, SendError<T>>());
+            } else if (sent.error().is_disconnected()) {
+              on_send(std::expected<void, SendError<T>>(std::unexpected(
+                  SendError<T>{std::move(sent.error().item)})));
+            } else {
+              item.emplace(std::move(sent.error().item));
+              return false;
+            }
+            return true;
+          },
+      });
+    } else {
+      // Sending on an unbounded channel never blocks.
+      this->operations.push_back({
+          nullptr,
+          [&sender, item = std::optional<T>(std::move(item)),
+           on_send = std::move(on_send)]() mutable {
+            if (!item) {
+              return false;
+            }
+            auto sent = sender.send(std::move(*item));
+            item.reset();
+            on_send(std::move(sent));
+            return true;
+          },
+      });
+    }
+    return this->operations.size() - 1;
+  }
+
+  /// Complete an operation that is ready without blocking.
+  ///
+  /// Returns the index of the completed operation, or `std::nullopt` if no
+  /// operation is ready.
+  std::optional<std::size_t> try_wait() {
+    auto count = this->operations.size();
+    for (std::size_t offset = 0; offset < count; ++offset) {
+      auto index = (this->next_index + offset) % count;
+      if (this->operations[index].attempt()) {
+        this->next_index = index + 1;
+        return index;
+      }
+    }
+    return {};
+  }
+
+  /// Block until an operation completes.
+  ///
+  /// Returns the index of the completed operation.
+  std::size_t wait() {
+    return *this->wait_impl([](detail::ThreadWaker &waker) {
+      waker.wait();
+      return true;
+    });
+  }
+
+  /// Block until an operation completes or the timeout is met.
+  ///
+  /// Returns the index of the completed operation, or `std::nullopt` if the
+  /// timeout was met first.
+  template <typename Rep, typename Period>
+  std::optional<std::size_t>
+  wait_for(const std::chrono::duration<Rep, Period> &timeout) {
+    return this->wait_until(std::chrono::steady_clock::now() + timeout);
+  }
+
+  /// Block until an operation completes or the deadline is met.
+  ///
+  /// Returns the index of the completed operation, or `std::nullopt` if the
+  /// deadline was met first.
+  template <typename Clock, typename Duration>
+  std::optional<std::size_t>
+  wait_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    return this->wait_impl(
+        [&](detail::ThreadWaker &waker) { return waker.wait_until(deadline); });
+  }
+
+private:
+  /// Register a waker with every operation's channel and alternate between
+  /// trying the operations and calling `sleep` until one completes or `sleep`
+  /// returns `false`.
+  template <typename F>
+  std::optional<std::size_t> wait_impl(const F &sleep) {
+    if (auto index = this->try_wait()) {
+      return index;
+    }
+    detail::ThreadWaker waker;
+    for (auto &operation : this->operations) {
+      if (operation.wakers) {
+        operation.wakers->add(waker);
+      }
+    }
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    std::optional<std::size_t> index;
+    while (!(index = this->try_wait())) {
+      if (!sleep(waker)) {
+        index = this->try_wait();
+        break;
+      }
+    }
+    for (auto &operation : this->operations) {
+      if (operation.wakers) {
+        operation.wakers->remove(waker);
+      }
+    }
+    return index;
+  }
+};
+} // namespace chan
+
+#endif
@@ -8,6 +8,10 @@ template <typename T> struct SendError {
   /// Item that failed to send. Allows the caller to recover the item if needed.
   T item;
 };
+
+/// Error for operations that fail before there is an item, such as `reserve`.
+/// Occurs when there are no remaining receivers.
+template <> struct SendError<void> {};
 } // namespace chan
 
 #endif
@@ -0,0 +1,21 @@
+#ifndef _CHAN_SEND_RANGE_RESULT_H
+#define _CHAN_SEND_RANGE_RESULT_H
+
+#include <cstddef>
+
+namespace chan {
+/// Result of the `send_range`, `send_n`, and `try_send_n` operations.
+template <typename I> struct SendRangeResult {
+  /// Iterator to the first item that was not sent.
+  I next;
+
+  /// Number of items that were sent.
+  std::size_t count;
+
+  /// `true` if the operation stopped early because there are no remaining
+  /// receivers.
+  bool disconnected;
+};
+} // namespace chan
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef _CHAN_SEND_SLOT_H
+#define _CHAN_SEND_SLOT_H
+
+#include <cassert>
+#include <utility>
+
+namespace chan {
+/// Slot in a channel's storage, reserved by `Sender::reserve`, where an item is
+/// constructed in place instead of being moved into the channel.
+///
+/// Construct an item at `get()`, for example with placement new, then call
+/// `commit` to send it, or call `emplace` to do both.
+///
+/// # Safety
+/// Do not let a `SendSlot` outlive the `Sender` that reserved it, and do not
+/// send or reserve with that `Sender` until the slot is committed or
+/// destroyed.
+///
+/// Destroying a `SendSlot` without calling `commit` sends nothing. On mpsc
+/// channels, a reserved slot already has its place in the order items are
+/// received, so items sent after it are not received until it is committed or
+/// destroyed.
+template <typename T, typename C> class SendSlot {
+  C *channel;
+  C::Slot slot;
+
+public:
+  /// Create a `SendSlot` for a reserved slot.
+  ///
+  /// This constructor should not be called directly. Instead, call
+  /// `Sender::reserve`.
+  SendSlot(C *channel, C::Slot slot) : channel(channel), slot(slot) {}
+
+  /// Create a null `SendSlot`.
+  SendSlot() : channel(nullptr), slot() {}
+
+  ~SendSlot() { this->abandon(); }
+
+  SendSlot(SendSlot &&other)
+      : channel(std::exchange(other.channel, nullptr)), slot(other.slot) {}
+
+  SendSlot &operator=(SendSlot &&other) {
+    if (this != &other) {
+      this->abandon();
+      this->channel = std::exchange(other.channel, nullptr);
+      this->slot = other.slot;
+    }
+    return *this;
+  }
+
+  SendSlot(const SendSlot &) = delete;
+  SendSlot &operator=(const SendSlot &) = delete;
+
+  /// Return `true` if `this` does not hold a reserved slot.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Uninitialized storage for the item.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  T *get() const {
+    assert(this->channel != nullptr);
+    return C::slot_item(this->slot);
+  }
+
+  /// Send the item that was constructed at `get()`.
+  ///
+  /// Does not block. After calling this function, `is_null()` will be `true`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or no item has been
+  /// constructed at `get()`.
+  void commit() {
+    assert(this->channel != nullptr);
+    std::exchange(this->channel, nullptr)->commit_slot(this->slot);
+  }
+
+  /// Construct the item in the slot from `args` and send it.
+  ///
+  /// Does not block. After calling this function, `is_null()` will be `true`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. If the item's
+  /// constructor throws, `this` still holds the empty slot.
+  template <typename... Args> void emplace(Args &&...args) {
+    assert(this->channel != nullptr);
+    this->channel->construct_slot(this->slot, std::forward<Args>(args)...);
+    this->commit();
+  }
+
+private:
+  void abandon() {
+    if (this->channel != nullptr) {
+      std::exchange(this->channel, nullptr)->abandon_slot(this->slot);
+    }
+  }
+};
+} // namespace chan
+
+#endif
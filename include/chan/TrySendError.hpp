@@ -20,6 +20,21 @@ template <typename T> struct TrySendError {
     return this->kind == TrySendErrorKind::Disconnected;
   }
 };
+
+/// Error for non-blocking operations that fail before there is an item, such
+/// as `try_reserve`.
+template <> struct TrySendError<void> {
+  /// Reason the operation failed.
+  TrySendErrorKind kind;
+
+  /// Check if `kind` is `TrySendErrorKind::Full`.
+  bool is_full() const { return this->kind == TrySendErrorKind::Full; }
+
+  /// Check if `kind` is `TrySendErrorKind::Disconnected`.
+  bool is_disconnected() const {
+    return this->kind == TrySendErrorKind::Disconnected;
+  }
+};
 } // namespace chan
 
 #endif
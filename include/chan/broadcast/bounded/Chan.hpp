@@ -0,0 +1,527 @@
+#ifndef _CHAN_BROADCAST_BOUNDED_CHANNEL_H
+#define _CHAN_BROADCAST_BOUNDED_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "../../RecvError.hpp"
+#include "../../RecvView.hpp"
+#include "../../SendError.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../TryRecvError.hpp"
+#include "../../TrySendError.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+#include "../../detail/WakeAllEvent.hpp"
+#include "Cursor.hpp"
+
+namespace chan::broadcast::bounded {
+/// Channel implementation.
+///
+/// `tail_index` counts the items sent so far and only the sender writes it.
+/// Every `Receiver` has its own `Cursor` counting the items it has received.
+/// An item is constructed once, in the slot for its position, and every
+/// receiver reads it in that slot, either by peeking or by copying it out. A
+/// receiver's cursor only moves past the slot once it is done reading. The
+/// sender can reuse a slot once every cursor has moved past it, so the slowest
+/// receiver holds the sender back.
+///
+/// The sender only looks at the cursors when its cached copy of the slowest
+/// one says the channel is full. The cursors are linked together under
+/// `cursor_mutex`, which is only locked for that scan and to add or remove a
+/// receiver.
+///
+/// Receivers wait for different items, so they sleep on a `WakeAllEvent`
+/// instead of an `EventCount`, and every send wakes all of them.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T, typename W, typename A> class Chan {
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
+  template <typename, typename> friend class chan::RecvView;
+
+  using CursorAllocator =
+      std::allocator_traits<A>::template rebind_alloc<Cursor>;
+
+  A allocator;
+  std::allocator_traits<A>::pointer item_buffer;
+  std::size_t capacity;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  std::size_t cached_min_index;
+
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::WakeAllEvent<W> recv_ready;
+
+  alignas(detail::CACHE_LINE_SIZE) std::mutex cursor_mutex;
+  CursorAllocator cursor_allocator;
+  Cursor *cursors;
+  std::size_t receiver_count;
+  std::atomic_bool _send_done;
+  std::atomic_bool _recv_done;
+  std::atomic_bool disconnected;
+
+public:
+  /// Item a receiver is reading, which it has not moved its cursor past yet.
+  struct Slot {
+    Cursor *cursor;
+    T *item;
+  };
+
+  /// Create a channel with no receivers.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(std::size_t capacity, A allocator)
+      : allocator(std::move(allocator)),
+        item_buffer(
+            std::allocator_traits<A>::allocate(this->allocator, capacity)),
+        capacity(capacity), tail_index(0), cached_min_index(0),
+        cursor_allocator(this->allocator), cursors(nullptr),
+        receiver_count(0), _send_done(false), _recv_done(false),
+        disconnected(false) {}
+
+  ~Chan() {
+    auto count = std::min(this->tail_index.load(std::memory_order::relaxed),
+                          this->capacity);
+    for (std::size_t slot = 0; slot < count; ++slot) {
+      std::allocator_traits<A>::destroy(this->allocator,
+                                        this->item_buffer + slot);
+    }
+    std::allocator_traits<A>::deallocate(this->allocator, this->item_buffer,
+                                         this->capacity);
+  }
+
+private:
+  std::expected<void, SendError<T>> send(T item) {
+    auto disconnected = false;
+    this->send_ready.wait(
+        [&] { return this->try_send_once(item, disconnected); });
+    if (disconnected) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    this->recv_ready.notify_all();
+    return {};
+  }
+
+  std::expected<void, TrySendError<T>> try_send(T item) {
+    auto disconnected = false;
+    auto sent = this->try_send_once(item, disconnected);
+    return this->try_send_impl(item, disconnected, sent);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<T>>
+  try_send_for(T item, const std::chrono::duration<Rep, Period> &timeout) {
+    return this->try_send_until(std::move(item),
+                                std::chrono::steady_clock::now() + timeout);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<T>>
+  try_send_until(T item,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    auto disconnected = false;
+    auto sent = this->send_ready.wait_until(
+        [&] { return this->try_send_once(item, disconnected); }, deadline);
+    return this->try_send_impl(item, disconnected, sent);
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    std::size_t count = 0;
+    while (count != n) {
+      auto disconnected = false;
+      std::size_t sent;
+      this->send_ready.wait([&] {
+        if (this->recv_done()) {
+          disconnected = true;
+          return true;
+        }
+        sent = this->try_do_send_n(first, n - count);
+        return sent != 0;
+      });
+      if (disconnected) {
+        return {std::move(first), count, true};
+      }
+      count += sent;
+      this->recv_ready.notify_all();
+    }
+    return {std::move(first), count, false};
+  }
+
+  template <typename I> SendRangeResult<I> try_send_n(I first, std::size_t n) {
+    if (this->recv_done()) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    auto sent = this->try_do_send_n(first, n);
+    if (sent != 0) {
+      this->recv_ready.notify_all();
+    }
+    return {std::move(first), sent, false};
+  }
+
+  std::expected<T, RecvError> recv(Cursor &cursor) {
+    return this->take(this->peek(cursor));
+  }
+
+  std::expected<T, TryRecvError> try_recv(Cursor &cursor) {
+    return this->take(this->try_peek(cursor));
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(Cursor &cursor,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    return this->try_recv_until(cursor,
+                                std::chrono::steady_clock::now() + timeout);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError>
+  try_recv_until(Cursor &cursor,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    return this->take(this->try_peek_until(cursor, deadline));
+  }
+
+  std::expected<Slot, RecvError> peek(Cursor &cursor) {
+    std::optional<Slot> slot;
+    auto disconnected = false;
+    this->recv_ready.wait(
+        [&] { return this->try_recv_once(cursor, slot, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return *slot;
+  }
+
+  std::expected<Slot, TryRecvError> try_peek(Cursor &cursor) {
+    std::optional<Slot> slot;
+    auto disconnected = false;
+    this->try_recv_once(cursor, slot, disconnected);
+    return this->try_peek_impl(slot, disconnected);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<Slot, TryRecvError>
+  try_peek_until(Cursor &cursor,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::optional<Slot> slot;
+    auto disconnected = false;
+    this->recv_ready.wait_until(
+        [&] { return this->try_recv_once(cursor, slot, disconnected); },
+        deadline);
+    return this->try_peek_impl(slot, disconnected);
+  }
+
+  /// Copy the item out of a slot from `peek` and move the cursor past it.
+  ///
+  /// If the copy throws, the cursor stays where it is.
+  template <typename E> std::expected<T, E> take(std::expected<Slot, E> slot) {
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    T item(*slot->item);
+    this->release_slot(*slot);
+    return item;
+  }
+
+  /// Move the cursor past a slot from `peek`. The item stays in the channel
+  /// for the other receivers, and the sender may reuse the slot once all of
+  /// them have moved past it.
+  void release_slot(Slot slot) {
+    slot.cursor->index.store(
+        slot.cursor->index.load(std::memory_order::relaxed) + 1,
+        std::memory_order::release);
+    this->send_ready.notify();
+  }
+
+  static T *slot_item(Slot slot) { return slot.item; }
+
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(Cursor &cursor, O out,
+                                                std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    this->recv_ready.wait([&] {
+      return this->try_recv_n_once(cursor, out, n, received, disconnected);
+    });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    this->send_ready.notify();
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(Cursor &cursor, O out,
+                                                      std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    this->try_recv_n_once(cursor, out, n, received, disconnected);
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (received == 0) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    this->send_ready.notify();
+    return received;
+  }
+
+  bool try_do_send(T &item) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    if (this->free_slots(tail_index) == 0) {
+      return false;
+    }
+    this->put(tail_index, std::move(item));
+    this->tail_index.store(tail_index + 1, std::memory_order::release);
+    return true;
+  }
+
+  template <typename I> std::size_t try_do_send_n(I &first, std::size_t n) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    n = std::min(n, this->free_slots(tail_index));
+    for (std::size_t count = 0; count != n; ++count, ++first) {
+      this->put(tail_index + count, std::ranges::iter_move(first));
+    }
+    if (n != 0) {
+      this->tail_index.store(tail_index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  /// Construct the item for position `index`, destroying the item from the
+  /// previous lap.
+  template <typename U> void put(std::size_t index, U &&item) {
+    auto slot = this->item_buffer + index % this->capacity;
+    if (index >= this->capacity) {
+      std::allocator_traits<A>::destroy(this->allocator, slot);
+    }
+    std::allocator_traits<A>::construct(this->allocator, slot,
+                                        std::forward<U>(item));
+  }
+
+  std::optional<Slot> try_do_peek(Cursor &cursor) {
+    auto index = cursor.index.load(std::memory_order::relaxed);
+    if (this->filled_slots(cursor, index) == 0) {
+      return {};
+    }
+    return Slot{&cursor,
+                std::to_address(this->item_buffer + index % this->capacity)};
+  }
+
+  template <typename O>
+  std::size_t try_do_recv_n(Cursor &cursor, O &out, std::size_t n) {
+    auto index = cursor.index.load(std::memory_order::relaxed);
+    n = std::min(n, this->filled_slots(cursor, index));
+    for (std::size_t count = 0; count != n; ++count, ++out) {
+      *out = this->item_buffer[(index + count) % this->capacity];
+    }
+    if (n != 0) {
+      cursor.index.store(index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  /// Number of slots the sender can fill, scanning the cursors only when the
+  /// cached copy of the slowest one says the channel is full.
+  std::size_t free_slots(std::size_t tail_index) {
+    auto free = this->capacity - (tail_index - this->cached_min_index);
+    if (free == 0) {
+      this->cached_min_index = this->min_index(tail_index);
+      free = this->capacity - (tail_index - this->cached_min_index);
+    }
+    return free;
+  }
+
+  /// Number of items `cursor` has not received yet, reloading `tail_index`
+  /// only when the cached copy says there are none.
+  std::size_t filled_slots(Cursor &cursor, std::size_t index) {
+    auto filled = cursor.cached_tail_index - index;
+    if (filled == 0) {
+      cursor.cached_tail_index =
+          this->tail_index.load(std::memory_order::acquire);
+      filled = cursor.cached_tail_index - index;
+    }
+    return filled;
+  }
+
+  /// Index of the slowest receiver, or `tail_index` if there are none.
+  std::size_t min_index(std::size_t tail_index) {
+    std::lock_guard lock(this->cursor_mutex);
+    auto min_index = tail_index;
+    for (auto cursor = this->cursors; cursor; cursor = cursor->next) {
+      min_index =
+          std::min(min_index, cursor->index.load(std::memory_order::acquire));
+    }
+    return min_index;
+  }
+
+  /// Returns `true` when the operation is finished, either because the item
+  /// was sent or because there are no remaining receivers.
+  bool try_send_once(T &item, bool &disconnected) {
+    if (this->recv_done()) {
+      disconnected = true;
+      return true;
+    }
+    return this->try_do_send(item);
+  }
+
+  /// Returns `true` when the operation is finished, either because there is
+  /// an item for `cursor` or because `cursor` has received every item and the
+  /// sender is gone.
+  bool try_recv_once(Cursor &cursor, std::optional<Slot> &slot,
+                     bool &disconnected) {
+    slot = this->try_do_peek(cursor);
+    if (slot) {
+      return true;
+    }
+    if (this->send_done()) {
+      // The sender may have finished sending between the failed claim and the
+      // `send_done` check, so check one more time.
+      slot = this->try_do_peek(cursor);
+      disconnected = !slot;
+      return true;
+    }
+    return false;
+  }
+
+  /// Same as `try_recv_once`, but takes up to `n` items at once.
+  template <typename O>
+  bool try_recv_n_once(Cursor &cursor, O &out, std::size_t n,
+                       std::size_t &received, bool &disconnected) {
+    received = this->try_do_recv_n(cursor, out, n);
+    if (received != 0) {
+      return true;
+    }
+    if (this->send_done()) {
+      received = this->try_do_recv_n(cursor, out, n);
+      disconnected = received == 0;
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<void, TrySendError<T>>
+  try_send_impl(T &item, bool disconnected, bool sent) {
+    if (disconnected) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Disconnected, std::move(item)});
+    }
+    if (!sent) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Full, std::move(item)});
+    }
+    this->recv_ready.notify_all();
+    return {};
+  }
+
+  std::expected<Slot, TryRecvError>
+  try_peek_impl(const std::optional<Slot> &slot, bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!slot) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return *slot;
+  }
+
+  /// Number of items the slowest receiver has not received yet.
+  std::size_t size() {
+    auto tail_index = this->tail_index.load(std::memory_order::acquire);
+    return tail_index - this->min_index(tail_index);
+  }
+
+  /// Number of items `cursor` has not received yet.
+  std::size_t size(const Cursor &cursor) const {
+    return this->tail_index.load(std::memory_order::acquire) -
+           cursor.index.load(std::memory_order::relaxed);
+  }
+
+  bool send_done() const {
+    return this->_send_done.load(std::memory_order::acquire);
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire);
+  }
+
+  /// Add a cursor for a new receiver.
+  ///
+  /// The new receiver starts where `from` is, or at the first item if `from`
+  /// is null. `from` must belong to the calling thread, so it cannot move past
+  /// an item while the new cursor is linked in, and the sender cannot reuse
+  /// the slots between the two.
+  Cursor *acquire_receiver(const Cursor *from) {
+    auto cursor = std::allocator_traits<CursorAllocator>::allocate(
+        this->cursor_allocator, 1);
+    auto index = from ? from->index.load(std::memory_order::relaxed) : 0;
+    std::allocator_traits<CursorAllocator>::construct(
+        this->cursor_allocator, cursor, index,
+        from ? from->cached_tail_index : 0, nullptr, nullptr);
+    std::lock_guard lock(this->cursor_mutex);
+    cursor->next = this->cursors;
+    if (this->cursors) {
+      this->cursors->prev = cursor;
+    }
+    this->cursors = cursor;
+    ++this->receiver_count;
+    return cursor;
+  }
+
+  bool release_sender() {
+    this->_send_done.store(true, std::memory_order::release);
+    this->recv_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver(Cursor *cursor) {
+    bool last;
+    {
+      std::lock_guard lock(this->cursor_mutex);
+      if (cursor->prev) {
+        cursor->prev->next = cursor->next;
+      } else {
+        this->cursors = cursor->next;
+      }
+      if (cursor->next) {
+        cursor->next->prev = cursor->prev;
+      }
+      last = --this->receiver_count == 0;
+    }
+    std::allocator_traits<CursorAllocator>::destroy(this->cursor_allocator,
+                                                    cursor);
+    std::allocator_traits<CursorAllocator>::deallocate(this->cursor_allocator,
+                                                       cursor, 1);
+    if (!last) {
+      // The sender may be waiting for this receiver.
+      this->send_ready.notify();
+      return false;
+    }
+    this->_recv_done.store(true, std::memory_order::release);
+    this->send_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::broadcast::bounded
+
+#endif
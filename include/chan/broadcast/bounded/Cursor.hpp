@@ -0,0 +1,27 @@
+#ifndef _CHAN_BROADCAST_BOUNDED_CURSOR_H
+#define _CHAN_BROADCAST_BOUNDED_CURSOR_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+
+namespace chan::broadcast::bounded {
+/// Position of one `Receiver` in the channel's item buffer.
+///
+/// `index` counts the items the receiver has received so far. Only the
+/// receiver writes it. The sender reads it to find the slowest receiver.
+/// `prev` and `next` link the channel's cursors together and are only used
+/// while holding the channel's cursor mutex.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+struct Cursor {
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t index;
+  std::size_t cached_tail_index;
+  Cursor *prev;
+  Cursor *next;
+};
+} // namespace chan::broadcast::bounded
+
+#endif
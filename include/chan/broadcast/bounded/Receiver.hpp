@@ -0,0 +1,316 @@
+#ifndef _CHAN_BROADCAST_BOUNDED_RECEIVER_H
+#define _CHAN_BROADCAST_BOUNDED_RECEIVER_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+
+#include "../../RecvIter.hpp"
+#include "../../RecvView.hpp"
+#include "../../Select.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Cursor.hpp"
+
+namespace chan::broadcast::bounded {
+/// Receiving half of a channel.
+///
+/// Every `Receiver` receives every item sent after it was created, in order.
+/// Copying a `Receiver` creates another one that starts where the original
+/// is, so both receive the items the original has not received yet.
+///
+/// `peek` reads an item in place, so every `Receiver` shares the one copy the
+/// sender constructed. The other receive functions copy items out of the
+/// channel, so they need `T` to be copy constructible.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's item buffer
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Receiver` between threads. If multiple threads need to
+/// receive from the same channel, give each thread a its own `Receiver` copy.
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+class Receiver {
+  friend class chan::Select;
+
+public:
+  using Item = T;
+
+  /// Handle returned by `peek`.
+  using View = RecvView<const T, Chan<T, W, A1>>;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+  Cursor *cursor;
+
+public:
+  /// Create the initial `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Receiver(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)),
+        cursor(this->channel->acquire_receiver(nullptr)) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : channel(nullptr), allocator(), cursor(nullptr) {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)), cursor(other.cursor) {
+    other.channel = nullptr;
+    other.cursor = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      this->cursor = other.cursor;
+      other.channel = nullptr;
+      other.cursor = nullptr;
+    }
+    return *this;
+  }
+
+  Receiver(const Receiver &other)
+      : channel(other.channel), allocator(other.allocator), cursor(nullptr) {
+    this->acquire(other.cursor);
+  }
+
+  Receiver &operator=(const Receiver &other) {
+    if (this != &other) {
+      this->release();
+      this->channel = other.channel;
+      this->allocator = other.allocator;
+      this->acquire(other.cursor);
+    }
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Receive the next item from the channel.
+  ///
+  /// Blocks until there is an item this `Receiver` has not received or the
+  /// sender disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->recv(*this->cursor);
+  }
+
+  /// Receive the next item from the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv(*this->cursor);
+  }
+
+  /// Receive the next item from the channel with a timeout.
+  ///
+  /// Blocks until there is an item this `Receiver` has not received, the
+  /// timeout is met, or the sender disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_for(*this->cursor, timeout);
+  }
+
+  /// Receive the next item from the channel with a deadline.
+  ///
+  /// Blocks until there is an item this `Receiver` has not received, the
+  /// deadline is met, or the sender disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_until(*this->cursor, deadline);
+  }
+
+  /// Receive the next item from the channel without copying it out.
+  ///
+  /// Blocks until there is an item this `Receiver` has not received or the
+  /// sender disconnects.
+  ///
+  /// The item is read in place through the returned `RecvView`. This
+  /// `Receiver` moves past it when the view is released, and the item stays in
+  /// the channel for the other receivers.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<View, RecvError> peek() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->peek(*this->cursor);
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return View(channel, *slot);
+  }
+
+  /// Receive the next item from the channel without copying it out and
+  /// without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<View, TryRecvError> try_peek() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->try_peek(*this->cursor);
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return View(channel, *slot);
+  }
+
+  /// Receive the next item from the channel in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until there is
+  /// an item this `Receiver` has not received or the sender disconnects, then
+  /// returns what `recv()` would have returned. The coroutine is resumed by a
+  /// function object that is passed to `executor`, which must queue it to run
+  /// on some thread rather than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Receive up to `items.size()` items from the channel.
+  ///
+  /// Blocks until there is an item this `Receiver` has not received or the
+  /// sender disconnects. Then takes as many items as are available, up to
+  /// `items.size()`, in a single step.
+  ///
+  /// Returns the number of items received. They are copy-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, RecvError> recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->recv_n(*this->cursor, items.begin(), items.size());
+  }
+
+  /// Receive up to `items.size()` items from the channel without blocking.
+  ///
+  /// Returns the number of items received. They are copy-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, TryRecvError>
+  try_recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(*this->cursor, items.begin(),
+                                     items.size());
+  }
+
+  /// Copy up to `limit` items from the channel to `out` without blocking.
+  ///
+  /// Returns the number of items received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::weakly_incrementable O>
+    requires std::indirectly_writable<O, const T &>
+  std::expected<std::size_t, TryRecvError>
+  drain_into(O out, std::size_t limit =
+                        std::numeric_limits<std::size_t>::max()) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(*this->cursor, std::move(out), limit);
+  }
+
+  /// Number of items this `Receiver` has not received yet.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a receive operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size(*this->cursor);
+  }
+
+  /// Number of items the channel has allocated space for.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire(const Cursor *from) {
+    if (this->channel) {
+      this->cursor = this->channel->acquire_receiver(from);
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_receiver(this->cursor)) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+    this->cursor = nullptr;
+  }
+
+  detail::WakerList &wakers() const {
+    return this->channel->recv_ready.wakers();
+  }
+
+public:
+  RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::broadcast::bounded
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef _CHAN_BROADCAST_BOUNDED_SENDER_H
+#define _CHAN_BROADCAST_BOUNDED_SENDER_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include "../../Select.hpp"
+#include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::broadcast::bounded {
+/// Sending half of a channel.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's item buffer
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Sender` between threads. A channel has a single `Sender`.
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+class Sender {
+  friend class chan::Select;
+
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Sender(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Sender`.
+  Sender() : channel(nullptr), allocator() {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &) = delete;
+  Sender &operator=(const Sender &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Send an item to every receiver.
+  ///
+  /// Blocks until the slowest receiver has made room or all receivers
+  /// disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, SendError<T>> send(T item) const {
+    assert(this->channel != nullptr);
+    return this->channel->send(std::move(item));
+  }
+
+  /// Send an item to every receiver without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, TrySendError<T>> try_send(T item) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send(std::move(item));
+  }
+
+  /// Send an item to every receiver with a timeout.
+  ///
+  /// Blocks until the slowest receiver has made room, the timeout is met, or
+  /// all receivers disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<T>>
+  try_send_for(T item,
+               const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_for(std::move(item), timeout);
+  }
+
+  /// Send an item to every receiver with a deadline.
+  ///
+  /// Blocks until the slowest receiver has made room, the deadline is met, or
+  /// all receivers disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<T>> try_send_until(
+      T item, const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_until(std::move(item), deadline);
+  }
+
+  /// Send an item on the channel in a coroutine.
+  ///
+  /// `co_await tx.async_send(item, executor)` suspends the coroutine until the
+  /// channel is not full or all receivers disconnect, then returns what
+  /// `send(item)` would have returned. The coroutine is resumed by a function
+  /// object that is passed to `executor`, which must queue it to run on some
+  /// thread rather than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_send(T item, E executor) const {
+    assert(this->channel != nullptr);
+    return detail::send_awaiter(*this, this->wakers(), std::move(item),
+                                std::move(executor));
+  }
+
+  /// Send every item in a range to every receiver.
+  ///
+  /// Items are moved out of the range. Blocks until every item is sent or all
+  /// receivers disconnect. Free slots are reserved for as many items as
+  /// possible at once, so a batch costs about as much synchronization as a
+  /// single item.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
+  /// Send up to `n` items, starting at `first`, on the channel without
+  /// blocking.
+  ///
+  /// Reserves as many free slots as are available, up to `n`, in one step and
+  /// sends that many items.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> try_send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_n(std::move(first), n);
+  }
+
+  /// Number of items the slowest receiver has not received yet.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a send operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Number of items the channel has allocated space for.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel && this->channel->release_sender()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+  detail::WakerList &wakers() const {
+    return this->channel->send_ready.wakers();
+  }
+
+public:
+  SendIter<Sender> begin() const { return SendIter(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::broadcast::bounded
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef _CHAN_BROADCAST_BOUNDED_CREATE_H
+#define _CHAN_BROADCAST_BOUNDED_CREATE_H
+
+#include <cassert>
+
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::broadcast::bounded {
+/// Create a new channel and get a `Sender` and `Receiver` for it.
+///
+/// Every copy of the `Receiver` receives every item. When the slowest
+/// `Receiver` has `capacity` items it has not received yet, sending blocks.
+///
+/// # Parameters
+/// `capacity` - Size of the channel's item buffer, which must not be 0
+/// `buffer_allocator` (optional) - Allocator for the channel's item buffer
+/// and receiver cursors
+/// `channel_allocator` (optional) - Allocator for the channel object
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Type of `buffer_allocator` parameter
+/// `A2` (optional) - Type of `channel_allocator` parameter
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+std::pair<Sender<T, W, A1, A2>, Receiver<T, W, A1, A2>>
+channel(std::size_t capacity, A1 buffer_allocator = A1(),
+        A2 channel_allocator = A2()) {
+  assert(capacity != 0);
+  auto channel = std::allocator_traits<A2>::allocate(channel_allocator, 1);
+  std::allocator_traits<A2>::construct(channel_allocator, channel, capacity,
+                                       std::move(buffer_allocator));
+
+  Sender<T, W, A1, A2> sender(channel, channel_allocator);
+  Receiver<T, W, A1, A2> receiver(std::move(channel),
+                                  std::move(channel_allocator));
+
+  return {std::move(sender), std::move(receiver)};
+}
+} // namespace chan::broadcast::bounded
+
+#endif
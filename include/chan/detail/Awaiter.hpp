@@ -0,0 +1,146 @@
+#ifndef _CHAN_DETAIL_AWAITER_H
+#define _CHAN_DETAIL_AWAITER_H
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <expected>
+#include <optional>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "Waker.hpp"
+#include "WakerList.hpp"
+
+namespace chan::detail {
+/// Awaitable that completes a channel operation without blocking the thread.
+///
+/// `poll()` tries the operation and returns its result, or `std::nullopt` if
+/// it would have to wait. If the first try fails, the coroutine is suspended
+/// and a waker is added to `wakers`. Every wake-up hands a function object to
+/// `executor`, which tries the operation again on whatever thread runs it and
+/// resumes the coroutine once it completes.
+///
+/// `pending` counts the wake-ups that have not been handled yet. Only the
+/// wake-up that raises it from zero calls `executor`, and whoever handles the
+/// wake-ups keeps trying until it brings `pending` back to zero. So `poll()`
+/// is never called by two threads at once and no wake-up is lost.
+template <typename Result, typename P, typename E> class Awaiter final : Waker {
+  WakerList *wakers;
+  P poll;
+  E executor;
+  std::optional<Result> result;
+  std::coroutine_handle<> handle;
+  std::atomic_size_t pending;
+
+public:
+  Awaiter(WakerList &wakers, P poll, E executor)
+      : wakers(&wakers), poll(std::move(poll)), executor(std::move(executor)),
+        pending(0) {}
+
+  bool await_ready() {
+    this->result = this->poll();
+    return this->result.has_value();
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    this->handle = handle;
+    this->pending.store(1, std::memory_order::relaxed);
+    this->wakers->add(*this);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    return !this->run();
+  }
+
+  Result await_resume() { return std::move(*this->result); }
+
+  void wake() override {
+    if (this->pending.fetch_add(1, std::memory_order::acq_rel) == 0) {
+      this->executor([this] {
+        if (this->run()) {
+          this->handle.resume();
+        }
+      });
+    }
+  }
+
+private:
+  /// Try the operation until it completes or every pending wake-up has been
+  /// handled.
+  ///
+  /// Returns `true` if the operation completed. Otherwise `this` may already be
+  /// in use by another thread and must not be touched.
+  bool run() {
+    auto pending = this->pending.load(std::memory_order::acquire);
+    while (true) {
+      if ((this->result = this->poll())) {
+        this->wakers->remove(*this);
+        return true;
+      }
+      auto remaining =
+          this->pending.fetch_sub(pending, std::memory_order::acq_rel) -
+          pending;
+      if (remaining == 0) {
+        return false;
+      }
+      pending = remaining;
+    }
+  }
+};
+
+/// Awaitable for an operation that never has to wait.
+template <typename Result> class ReadyAwaiter {
+  Result result;
+
+public:
+  explicit ReadyAwaiter(Result result) : result(std::move(result)) {}
+
+  bool await_ready() const { return true; }
+
+  void await_suspend(std::coroutine_handle<>) const {}
+
+  Result await_resume() { return std::move(this->result); }
+};
+
+/// Awaitable that receives an item from `receiver`.
+template <typename R, typename E>
+auto recv_awaiter(const R &receiver, WakerList &wakers, E executor) {
+  using T = R::Item;
+  auto poll = [&receiver]() -> std::optional<std::expected<T, RecvError>> {
+    auto item = receiver.try_recv();
+    if (item) {
+      return std::move(*item);
+    }
+    if (item.error().is_disconnected()) {
+      return std::unexpected(RecvError{});
+    }
+    return {};
+  };
+  return Awaiter<std::expected<T, RecvError>, decltype(poll), E>(
+      wakers, std::move(poll), std::move(executor));
+}
+
+/// Awaitable that sends `item` on `sender`.
+template <typename S, typename E>
+auto send_awaiter(const S &sender, WakerList &wakers, typename S::Item item,
+                  E executor) {
+  using T = S::Item;
+  auto poll = [&sender, item = std::optional<T>(std::move(item))]() mutable
+      -> std::optional<std::expected<void, SendError<T>>> {
+    auto sent = sender.try_send(std::move(*item));
+    item.reset();
+    if (sent) {
+      return std::expected<void, SendError<T>>();
+    }
+    if (sent.error().is_disconnected()) {
+      return std::unexpected(SendError<T>{std::move(sent.error().item)});
+    }
+    item.emplace(std::move(sent.error().item));
+    return {};
+  };
+  return Awaiter<std::expected<void, SendError<T>>, decltype(poll), E>(
+      wakers, std::move(poll), std::move(executor));
+}
+} // namespace chan::detail
+
+#endif
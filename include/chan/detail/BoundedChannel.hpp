@@ -1,11 +1,16 @@
 #ifndef _CHAN_DETAIL_BOUNDED_CHANNEL
 #define _CHAN_DETAIL_BOUNDED_CHANNEL
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <expected>
+#include <utility>
 
 #include "../RecvError.hpp"
 #include "../SendError.hpp"
+#include "../SendRangeResult.hpp"
 #include "../TryRecvError.hpp"
 #include "../TrySendError.hpp"
 
@@ -48,11 +53,30 @@ template <typename Self, typename T> struct BoundedChannel {
     });
   }
 
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    return this->send_n_impl(std::move(first), n, true, [&](std::size_t max) {
+      return static_cast<Self *>(this)->send_ready.acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+    });
+  }
+
+  template <typename I> SendRangeResult<I> try_send_n(I first, std::size_t n) {
+    return this->send_n_impl(std::move(first), n, false, [&](std::size_t max) {
+      return static_cast<Self *>(this)->send_ready.try_acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+    });
+  }
+
   std::expected<T, RecvError> recv() {
     if (!static_cast<Self *>(this)->send_done()) {
-      static_cast<Self *>(this)->recv_ready.acquire();
-      if (this->decrement_size()) {
-        return std::unexpected(RecvError{});
+      while (true) {
+        static_cast<Self *>(this)->recv_ready.acquire();
+        if (!this->decrement_size()) {
+          break;
+        }
+        if (!this->skip_abandoned()) {
+          return std::unexpected(RecvError{});
+        }
       }
       auto item = static_cast<Self *>(this)->do_recv();
       static_cast<Self *>(this)->send_ready.release();
@@ -73,9 +97,9 @@ template <typename Self, typename T> struct BoundedChannel {
   template <typename Rep, typename Period>
   std::expected<T, TryRecvError>
   try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
-    return this->try_recv_impl([&] {
-      return static_cast<Self *>(this)->recv_ready.try_acquire_for(timeout);
-    });
+    // A deadline, so waking up for an abandoned slot doesn't restart the
+    // timeout.
+    return this->try_recv_until(std::chrono::steady_clock::now() + timeout);
   }
 
   template <typename Clock, typename Duration>
@@ -86,6 +110,123 @@ template <typename Self, typename T> struct BoundedChannel {
     });
   }
 
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    auto received = this->recv_n_impl(out, n, [&](std::size_t max) {
+      return static_cast<Self *>(this)->recv_ready.acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+    });
+    if (received == 0 && n != 0) {
+      return std::unexpected(RecvError{});
+    }
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    auto empty = false;
+    auto received = this->recv_n_impl(out, n, [&](std::size_t max) {
+      auto permits = static_cast<Self *>(this)->recv_ready.try_acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+      empty = permits == 0;
+      return permits;
+    });
+    if (received == 0 && n != 0) {
+      return std::unexpected(TryRecvError{
+          empty ? TryRecvErrorKind::Empty : TryRecvErrorKind::Disconnected});
+    }
+    return received;
+  }
+
+  /// Claim a free slot without filling it. `Self::do_reserve` claims the slot
+  /// once a permit has been acquired for it.
+  auto reserve() {
+    using Result = std::expected<typename Self::Slot, SendError<void>>;
+    if (static_cast<Self *>(this)->recv_done()) {
+      return Result(std::unexpected(SendError<void>{}));
+    }
+    static_cast<Self *>(this)->send_ready.acquire();
+    if (static_cast<Self *>(this)->recv_done()) {
+      return Result(std::unexpected(SendError<void>{}));
+    }
+    return Result(static_cast<Self *>(this)->do_reserve());
+  }
+
+  auto try_reserve() {
+    return this->try_reserve_impl(
+        [&] { return static_cast<Self *>(this)->send_ready.try_acquire(); });
+  }
+
+  template <typename Rep, typename Period>
+  auto try_reserve_for(const std::chrono::duration<Rep, Period> &timeout) {
+    return this->try_reserve_impl([&] {
+      return static_cast<Self *>(this)->send_ready.try_acquire_for(timeout);
+    });
+  }
+
+  template <typename Clock, typename Duration>
+  auto
+  try_reserve_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    return this->try_reserve_impl([&] {
+      return static_cast<Self *>(this)->send_ready.try_acquire_until(deadline);
+    });
+  }
+
+  /// Publish a slot from `reserve` once its item has been constructed.
+  template <typename S> void commit_slot(S slot) {
+    static_cast<Self *>(this)->do_commit_slot(slot);
+    static_cast<Self *>(this)->size.fetch_add(1, std::memory_order::relaxed);
+    static_cast<Self *>(this)->recv_ready.release();
+  }
+
+  /// Publish a slot from `reserve` that will never hold an item. It is not
+  /// counted in `size`, but the permit wakes the receiver to free it.
+  template <typename S> void abandon_slot(S slot) {
+    static_cast<Self *>(this)->do_abandon_slot(slot);
+    static_cast<Self *>(this)->recv_ready.release();
+  }
+
+  /// Claim the next item like `recv`, but leave it in its slot.
+  /// `Self::do_peek` waits for the item to be published and returns its slot.
+  auto peek() {
+    using Result = std::expected<typename Self::Slot, RecvError>;
+    while (true) {
+      if (!static_cast<Self *>(this)->send_done()) {
+        static_cast<Self *>(this)->recv_ready.acquire();
+      }
+      if (!this->decrement_size()) {
+        return Result(static_cast<Self *>(this)->do_peek());
+      }
+      if (!this->skip_abandoned()) {
+        return Result(std::unexpected(RecvError{}));
+      }
+    }
+  }
+
+  auto try_peek() {
+    using Result = std::expected<typename Self::Slot, TryRecvError>;
+    while (true) {
+      if (!static_cast<Self *>(this)->send_done() &&
+          !static_cast<Self *>(this)->recv_ready.try_acquire()) {
+        return Result(std::unexpected(TryRecvError{TryRecvErrorKind::Empty}));
+      }
+      if (!this->decrement_size()) {
+        return Result(static_cast<Self *>(this)->do_peek());
+      }
+      if (!this->skip_abandoned()) {
+        return Result(
+            std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected}));
+      }
+    }
+  }
+
+  /// Destroy the item in a slot from `peek` and free the slot for senders.
+  template <typename S> void release_slot(S slot) {
+    static_cast<Self *>(this)->do_release_slot(slot);
+    // Without senders, the extra permit is never acquired.
+    static_cast<Self *>(this)->send_ready.release();
+  }
+
 private:
   template <typename F>
   std::expected<void, TrySendError<T>> try_send_impl(T item, const F &acquire) {
@@ -107,14 +248,74 @@ private:
     return {};
   }
 
+  template <typename F> auto try_reserve_impl(const F &acquire) {
+    using Result = std::expected<typename Self::Slot, TrySendError<void>>;
+    if (static_cast<Self *>(this)->recv_done()) {
+      return Result(std::unexpected(
+          TrySendError<void>{TrySendErrorKind::Disconnected}));
+    }
+    if (!acquire()) {
+      return Result(
+          std::unexpected(TrySendError<void>{TrySendErrorKind::Full}));
+    }
+    if (static_cast<Self *>(this)->recv_done()) {
+      return Result(std::unexpected(
+          TrySendError<void>{TrySendErrorKind::Disconnected}));
+    }
+    return Result(static_cast<Self *>(this)->do_reserve());
+  }
+
+  /// Reserve slots for as many of the remaining items as `acquire` allows in
+  /// one step, then publish them with a single release. A blocking send keeps
+  /// going until all `n` items are sent.
+  template <typename I, typename F>
+  SendRangeResult<I> send_n_impl(I first, std::size_t n, bool block,
+                                 const F &acquire) {
+    std::size_t count = 0;
+    while (count != n) {
+      if (static_cast<Self *>(this)->recv_done()) {
+        return {std::move(first), count, true};
+      }
+      auto permits = static_cast<std::size_t>(
+          acquire(std::min(n - count, static_cast<std::size_t>(
+                                          PTRDIFF_MAX))));
+      if (permits == 0) {
+        break;
+      }
+      if (static_cast<Self *>(this)->recv_done()) {
+        // Other blocked senders are waiting on the permits that were released
+        // when the receivers disconnected, so hand them back.
+        static_cast<Self *>(this)->send_ready.release(
+            static_cast<std::ptrdiff_t>(permits));
+        return {std::move(first), count, true};
+      }
+      first = static_cast<Self *>(this)->do_send_n(std::move(first), permits);
+      static_cast<Self *>(this)->size.fetch_add(permits,
+                                                std::memory_order::relaxed);
+      static_cast<Self *>(this)->recv_ready.release(
+          static_cast<std::ptrdiff_t>(permits));
+      count += permits;
+      if (!block) {
+        break;
+      }
+    }
+    return {std::move(first), count, false};
+  }
+
   template <typename F>
   std::expected<T, TryRecvError> try_recv_impl(const F &acquire) {
     if (!static_cast<Self *>(this)->send_done()) {
-      if (!acquire()) {
-        return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
-      }
-      if (this->decrement_size()) {
-        return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+      while (true) {
+        if (!acquire()) {
+          return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+        }
+        if (!this->decrement_size()) {
+          break;
+        }
+        if (!this->skip_abandoned()) {
+          return std::unexpected(
+              TryRecvError{TryRecvErrorKind::Disconnected});
+        }
       }
       auto item = static_cast<Self *>(this)->do_recv();
       static_cast<Self *>(this)->send_ready.release();
@@ -127,14 +328,76 @@ private:
     }
   }
 
-  bool decrement_size() {
+  /// Take up to `n` items with a single claim. Returns 0 if the channel is
+  /// empty and there are no remaining senders.
+  template <typename O, typename F>
+  std::size_t recv_n_impl(O &out, std::size_t n, const F &acquire) {
+    if (n == 0) {
+      return 0;
+    }
+    n = std::min(n, static_cast<std::size_t>(PTRDIFF_MAX));
+    if (!static_cast<Self *>(this)->send_done()) {
+      while (true) {
+        auto permits = static_cast<std::size_t>(acquire(n));
+        if (permits == 0) {
+          return 0;
+        }
+        auto received = this->decrement_size(permits);
+        auto abandoned = received != permits && this->skip_abandoned();
+        if (received != permits && !abandoned) {
+          // The extra permits were released for disconnecting senders, and
+          // other receivers may be waiting on them.
+          static_cast<Self *>(this)->recv_ready.release(
+              static_cast<std::ptrdiff_t>(permits - received));
+        }
+        if (received != 0) {
+          static_cast<Self *>(this)->do_recv_n(out, received);
+          static_cast<Self *>(this)->send_ready.release(
+              static_cast<std::ptrdiff_t>(received));
+          return received;
+        }
+        if (!abandoned) {
+          return 0;
+        }
+      }
+    } else {
+      auto received = this->decrement_size(n);
+      if (received != 0) {
+        static_cast<Self *>(this)->do_recv_n(out, received);
+      }
+      return received;
+    }
+  }
+
+  /// Call after a permit turned out to have no item for it. If senders remain,
+  /// the permit was released for an abandoned slot rather than a disconnect,
+  /// so free the abandoned slots at the head and return `true` to wait again.
+  ///
+  /// Only channels whose senders can reserve slots define
+  /// `Self::do_skip_abandoned`.
+  bool skip_abandoned() {
+    if constexpr (requires(Self &self) { self.do_skip_abandoned(); }) {
+      if (!static_cast<Self *>(this)->send_done()) {
+        static_cast<Self *>(this)->do_skip_abandoned();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool decrement_size() { return this->decrement_size(1) == 0; }
+
+  /// Decrement the size by up to `n`. Returns how much it was decremented by.
+  std::size_t decrement_size(std::size_t n) {
     std::size_t size;
+    std::size_t taken;
     do {
       size = static_cast<Self *>(this)->size.load(std::memory_order::relaxed);
-    } while (size != 0 &&
+      taken = std::min(size, n);
+    } while (taken != 0 &&
              !static_cast<Self *>(this)->size.compare_exchange_weak(
-                 size, size - 1, std::memory_order::relaxed));
-    return size == 0;
+                 size, size - taken, std::memory_order::relaxed));
+    return taken;
   }
 };
 } // namespace chan::detail
@@ -0,0 +1,363 @@
+#ifndef _CHAN_DETAIL_BOUNDED_RING_CHANNEL_H
+#define _CHAN_DETAIL_BOUNDED_RING_CHANNEL_H
+
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <optional>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../SendRangeResult.hpp"
+#include "../TryRecvError.hpp"
+#include "../TrySendError.hpp"
+
+namespace chan::detail {
+/// Bounded channel operations for a `Chan` that can claim a slot without
+/// blocking.
+///
+/// `Self` provides `try_do_send(T &)`, which moves the item into a free slot
+/// and returns `true` or leaves the item alone and returns `false` when full,
+/// and `try_do_recv()`, which returns an empty `std::optional` when empty.
+/// `try_do_send_n(first, n)` claims up to `n` free slots at once, moves that
+/// many items out of `first`, advancing it, and returns how many it claimed.
+/// `try_do_recv_n(out, n)` does the same for up to `n` filled slots, moving
+/// the items to `out`.
+/// `send_ready` and `recv_ready` are `EventCount`s, so a side only sleeps, and
+/// the other side only wakes it, when a claim actually fails.
+///
+/// For in-place sends and receives, `Self` also provides a `Slot` type,
+/// `try_do_reserve(Slot &)` and `try_do_peek(Slot &)`, which find the next
+/// free or filled slot without claiming it and return `false` when there is
+/// none, and `do_commit_slot(Slot)` and `do_release_slot(Slot)`, which claim
+/// it once the item has been constructed or read.
+template <typename Self, typename T> struct BoundedRingChannel {
+  std::expected<void, SendError<T>> send(T item) {
+    auto disconnected = false;
+    static_cast<Self *>(this)->send_ready.wait(
+        [&] { return this->try_send_once(item, disconnected); });
+    if (disconnected) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    static_cast<Self *>(this)->recv_ready.notify();
+    return {};
+  }
+
+  std::expected<void, TrySendError<T>> try_send(T item) {
+    auto disconnected = false;
+    auto sent = this->try_send_once(item, disconnected);
+    return this->try_send_impl(item, disconnected, sent);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<T>>
+  try_send_for(T item, const std::chrono::duration<Rep, Period> &timeout) {
+    auto disconnected = false;
+    auto sent = static_cast<Self *>(this)->send_ready.wait_for(
+        [&] { return this->try_send_once(item, disconnected); }, timeout);
+    return this->try_send_impl(item, disconnected, sent);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<T>>
+  try_send_until(T item,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    auto disconnected = false;
+    auto sent = static_cast<Self *>(this)->send_ready.wait_until(
+        [&] { return this->try_send_once(item, disconnected); }, deadline);
+    return this->try_send_impl(item, disconnected, sent);
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    std::size_t count = 0;
+    while (count != n) {
+      auto disconnected = false;
+      std::size_t sent;
+      static_cast<Self *>(this)->send_ready.wait([&] {
+        if (static_cast<Self *>(this)->recv_done()) {
+          disconnected = true;
+          return true;
+        }
+        sent = static_cast<Self *>(this)->try_do_send_n(first, n - count);
+        return sent != 0;
+      });
+      if (disconnected) {
+        return {std::move(first), count, true};
+      }
+      count += sent;
+      static_cast<Self *>(this)->recv_ready.notify(sent);
+    }
+    return {std::move(first), count, false};
+  }
+
+  template <typename I> SendRangeResult<I> try_send_n(I first, std::size_t n) {
+    if (static_cast<Self *>(this)->recv_done()) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    auto sent = static_cast<Self *>(this)->try_do_send_n(first, n);
+    if (sent != 0) {
+      static_cast<Self *>(this)->recv_ready.notify(sent);
+    }
+    return {std::move(first), sent, false};
+  }
+
+  std::expected<T, RecvError> recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_once(item, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    static_cast<Self *>(this)->send_ready.notify();
+    return std::move(*item);
+  }
+
+  std::expected<T, TryRecvError> try_recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    this->try_recv_once(item, disconnected);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_for(
+        [&] { return this->try_recv_once(item, disconnected); }, timeout);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError>
+  try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_until(
+        [&] { return this->try_recv_once(item, disconnected); }, deadline);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_n_once(out, n, received, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    static_cast<Self *>(this)->send_ready.notify(received);
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    this->try_recv_n_once(out, n, received, disconnected);
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (received == 0) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    static_cast<Self *>(this)->send_ready.notify(received);
+    return received;
+  }
+
+  auto reserve() {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    static_cast<Self *>(this)->send_ready.wait(
+        [&] { return this->try_reserve_once(slot, disconnected); });
+    using Result = std::expected<typename Self::Slot, SendError<void>>;
+    if (disconnected) {
+      return Result(std::unexpected(SendError<void>{}));
+    }
+    return Result(slot);
+  }
+
+  auto try_reserve() {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    auto reserved = this->try_reserve_once(slot, disconnected);
+    return this->try_reserve_impl(slot, disconnected, reserved);
+  }
+
+  template <typename Rep, typename Period>
+  auto try_reserve_for(const std::chrono::duration<Rep, Period> &timeout) {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    auto reserved = static_cast<Self *>(this)->send_ready.wait_for(
+        [&] { return this->try_reserve_once(slot, disconnected); }, timeout);
+    return this->try_reserve_impl(slot, disconnected, reserved);
+  }
+
+  template <typename Clock, typename Duration>
+  auto
+  try_reserve_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    auto reserved = static_cast<Self *>(this)->send_ready.wait_until(
+        [&] { return this->try_reserve_once(slot, disconnected); }, deadline);
+    return this->try_reserve_impl(slot, disconnected, reserved);
+  }
+
+  template <typename S> void commit_slot(S slot) {
+    static_cast<Self *>(this)->do_commit_slot(slot);
+    static_cast<Self *>(this)->recv_ready.notify();
+  }
+
+  auto peek() {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_peek_once(slot, disconnected); });
+    using Result = std::expected<typename Self::Slot, RecvError>;
+    if (disconnected) {
+      return Result(std::unexpected(RecvError{}));
+    }
+    return Result(slot);
+  }
+
+  auto try_peek() {
+    typename Self::Slot slot{};
+    auto disconnected = false;
+    auto peeked = this->try_peek_once(slot, disconnected);
+    using Result = std::expected<typename Self::Slot, TryRecvError>;
+    if (disconnected) {
+      return Result(
+          std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected}));
+    }
+    if (!peeked) {
+      return Result(std::unexpected(TryRecvError{TryRecvErrorKind::Empty}));
+    }
+    return Result(slot);
+  }
+
+  template <typename S> void release_slot(S slot) {
+    static_cast<Self *>(this)->do_release_slot(slot);
+    static_cast<Self *>(this)->send_ready.notify();
+  }
+
+private:
+  /// Returns `true` when the operation is finished, either because the item
+  /// was sent or because there are no remaining receivers.
+  bool try_send_once(T &item, bool &disconnected) {
+    if (static_cast<Self *>(this)->recv_done()) {
+      disconnected = true;
+      return true;
+    }
+    return static_cast<Self *>(this)->try_do_send(item);
+  }
+
+  /// Returns `true` when the operation is finished, either because an item
+  /// was received or because the channel is empty and there are no remaining
+  /// senders.
+  bool try_recv_once(std::optional<T> &item, bool &disconnected) {
+    item = static_cast<Self *>(this)->try_do_recv();
+    if (item) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      // Senders may have finished sending between the failed claim and the
+      // `send_done` check, so check one more time.
+      item = static_cast<Self *>(this)->try_do_recv();
+      disconnected = !item;
+      return true;
+    }
+    return false;
+  }
+
+  /// Same as `try_send_once`, but only finds a free slot.
+  template <typename S> bool try_reserve_once(S &slot, bool &disconnected) {
+    if (static_cast<Self *>(this)->recv_done()) {
+      disconnected = true;
+      return true;
+    }
+    return static_cast<Self *>(this)->try_do_reserve(slot);
+  }
+
+  /// Same as `try_recv_once`, but only finds a filled slot.
+  template <typename S> bool try_peek_once(S &slot, bool &disconnected) {
+    if (static_cast<Self *>(this)->try_do_peek(slot)) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      disconnected = !static_cast<Self *>(this)->try_do_peek(slot);
+      return true;
+    }
+    return false;
+  }
+
+  /// Same as `try_recv_once`, but claims up to `n` items at once.
+  template <typename O>
+  bool try_recv_n_once(O &out, std::size_t n, std::size_t &received,
+                       bool &disconnected) {
+    received = static_cast<Self *>(this)->try_do_recv_n(out, n);
+    if (received != 0) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      received = static_cast<Self *>(this)->try_do_recv_n(out, n);
+      disconnected = received == 0;
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<void, TrySendError<T>>
+  try_send_impl(T &item, bool disconnected, bool sent) {
+    if (disconnected) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Disconnected, std::move(item)});
+    }
+    if (!sent) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Full, std::move(item)});
+    }
+    static_cast<Self *>(this)->recv_ready.notify();
+    return {};
+  }
+
+  template <typename S>
+  std::expected<S, TrySendError<void>>
+  try_reserve_impl(S slot, bool disconnected, bool reserved) {
+    if (disconnected) {
+      return std::unexpected(
+          TrySendError<void>{TrySendErrorKind::Disconnected});
+    }
+    if (!reserved) {
+      return std::unexpected(TrySendError<void>{TrySendErrorKind::Full});
+    }
+    return slot;
+  }
+
+  std::expected<T, TryRecvError> try_recv_impl(std::optional<T> &item,
+                                               bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!item) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    static_cast<Self *>(this)->send_ready.notify();
+    return std::move(*item);
+  }
+};
+} // namespace chan::detail
+
+#endif
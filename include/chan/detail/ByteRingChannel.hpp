@@ -0,0 +1,208 @@
+#ifndef _CHAN_DETAIL_BYTE_RING_CHANNEL_H
+#define _CHAN_DETAIL_BYTE_RING_CHANNEL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <limits>
+#include <span>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../TryRecvError.hpp"
+#include "../TrySendError.hpp"
+
+namespace chan::detail {
+/// Operations for a channel of variable-length byte messages that are copied
+/// into a single contiguous ring buffer.
+///
+/// A message is stored as a frame: a `std::size_t` header followed by the
+/// message's bytes, padded so the next header is aligned. The header holds the
+/// message's size plus one, so a zeroed header is never a valid one. A frame
+/// never wraps around the end of the buffer. When it does not fit before the
+/// end, the rest of the buffer is skipped with a `PADDING` header and the
+/// frame starts over at the beginning, so a received message is always one
+/// contiguous span of the buffer.
+///
+/// `Self` provides `try_do_send(message)`, which copies the message into the
+/// buffer and returns `true` or returns `false` when there is no room for it,
+/// `try_do_recv(Slot &)`, which finds the next message and returns `false`
+/// when there is none, and `do_release_slot(Slot)`, which frees a message's
+/// frame and any padding before it. `send_ready` and `recv_ready` are
+/// `EventCount`s.
+template <typename Self> struct ByteRingChannel {
+  /// A received message and the number of bytes to free after it is read.
+  struct Slot {
+    std::span<const std::byte> message;
+    std::size_t size;
+  };
+
+  static constexpr std::size_t HEADER_SIZE = sizeof(std::size_t);
+  static constexpr std::size_t PADDING =
+      std::numeric_limits<std::size_t>::max();
+
+  /// Size of the buffer for a channel of `capacity` bytes: whole headers, and
+  /// enough for a message of at least one header.
+  static std::size_t buffer_size(std::size_t capacity) {
+    return std::max(align(capacity), 4 * HEADER_SIZE);
+  }
+
+  /// Largest message a buffer of `buffer_size` bytes takes. A frame no larger
+  /// than half the buffer fits in an empty buffer wherever the free space
+  /// starts, so a send never waits for room that can't be made.
+  static std::size_t max_message_size(std::size_t buffer_size) {
+    return (buffer_size / 2 - HEADER_SIZE) / HEADER_SIZE * HEADER_SIZE;
+  }
+
+  /// Number of bytes the frame of a message of `size` bytes takes up.
+  static std::size_t frame_size(std::size_t size) {
+    return HEADER_SIZE + align(size);
+  }
+
+  static std::size_t align(std::size_t size) {
+    return (size + HEADER_SIZE - 1) / HEADER_SIZE * HEADER_SIZE;
+  }
+
+  static const std::span<const std::byte> *slot_item(const Slot &slot) {
+    return &slot.message;
+  }
+
+  std::expected<void, SendError<void>>
+  send(std::span<const std::byte> message) {
+    auto disconnected = false;
+    static_cast<Self *>(this)->send_ready.wait(
+        [&] { return this->try_send_once(message, disconnected); });
+    if (disconnected) {
+      return std::unexpected(SendError<void>{});
+    }
+    static_cast<Self *>(this)->recv_ready.notify();
+    return {};
+  }
+
+  std::expected<void, TrySendError<void>>
+  try_send(std::span<const std::byte> message) {
+    auto disconnected = false;
+    auto sent = this->try_send_once(message, disconnected);
+    return this->try_send_impl(disconnected, sent);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<void>>
+  try_send_for(std::span<const std::byte> message,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    auto disconnected = false;
+    auto sent = static_cast<Self *>(this)->send_ready.wait_for(
+        [&] { return this->try_send_once(message, disconnected); }, timeout);
+    return this->try_send_impl(disconnected, sent);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<void>>
+  try_send_until(std::span<const std::byte> message,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    auto disconnected = false;
+    auto sent = static_cast<Self *>(this)->send_ready.wait_until(
+        [&] { return this->try_send_once(message, disconnected); }, deadline);
+    return this->try_send_impl(disconnected, sent);
+  }
+
+  std::expected<Slot, RecvError> recv() {
+    Slot slot{};
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_once(slot, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return slot;
+  }
+
+  std::expected<Slot, TryRecvError> try_recv() {
+    Slot slot{};
+    auto disconnected = false;
+    auto received = this->try_recv_once(slot, disconnected);
+    return this->try_recv_impl(slot, disconnected, received);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<Slot, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
+    Slot slot{};
+    auto disconnected = false;
+    auto received = static_cast<Self *>(this)->recv_ready.wait_for(
+        [&] { return this->try_recv_once(slot, disconnected); }, timeout);
+    return this->try_recv_impl(slot, disconnected, received);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<Slot, TryRecvError>
+  try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    Slot slot{};
+    auto disconnected = false;
+    auto received = static_cast<Self *>(this)->recv_ready.wait_until(
+        [&] { return this->try_recv_once(slot, disconnected); }, deadline);
+    return this->try_recv_impl(slot, disconnected, received);
+  }
+
+  void release_slot(const Slot &slot) {
+    static_cast<Self *>(this)->do_release_slot(slot);
+    // Blocked senders may each need a different amount of room, so one that
+    // still doesn't fit must not be the only one woken.
+    static_cast<Self *>(this)->send_ready.notify_all();
+  }
+
+private:
+  /// Returns `true` when the operation is finished, either because the
+  /// message was sent or because the receiver disconnected.
+  bool try_send_once(std::span<const std::byte> message, bool &disconnected) {
+    if (static_cast<Self *>(this)->recv_done()) {
+      disconnected = true;
+      return true;
+    }
+    return static_cast<Self *>(this)->try_do_send(message);
+  }
+
+  /// Returns `true` when the operation is finished, either because a message
+  /// was received or because the channel is empty and there are no remaining
+  /// senders.
+  bool try_recv_once(Slot &slot, bool &disconnected) {
+    if (static_cast<Self *>(this)->try_do_recv(slot)) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      // Senders may have finished sending between the failed claim and the
+      // `send_done` check, so check one more time.
+      disconnected = !static_cast<Self *>(this)->try_do_recv(slot);
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<void, TrySendError<void>> try_send_impl(bool disconnected,
+                                                        bool sent) {
+    if (disconnected) {
+      return std::unexpected(
+          TrySendError<void>{TrySendErrorKind::Disconnected});
+    }
+    if (!sent) {
+      return std::unexpected(TrySendError<void>{TrySendErrorKind::Full});
+    }
+    static_cast<Self *>(this)->recv_ready.notify();
+    return {};
+  }
+
+  std::expected<Slot, TryRecvError>
+  try_recv_impl(const Slot &slot, bool disconnected, bool received) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!received) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return slot;
+  }
+};
+} // namespace chan::detail
+
+#endif
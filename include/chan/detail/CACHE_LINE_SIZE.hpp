@@ -0,0 +1,42 @@
+#ifndef _CHAN_DETAIL_CACHE_LINE_SIZE_H
+#define _CHAN_DETAIL_CACHE_LINE_SIZE_H
+
+#include <cstddef>
+#include <new>
+
+namespace chan::detail {
+/// Alignment that keeps two objects off each other's cache line.
+///
+/// Members written by different threads are aligned to this so that a write
+/// by one thread does not invalidate the line the other thread is reading.
+///
+/// GCC warns that the value may differ between compiler flags, which would
+/// change the layout of channels shared across translation units. Channels are
+/// header-only and not meant to cross an ABI boundary, so the warning is
+/// silenced.
+#ifdef __cpp_lib_hardware_interference_size
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t CACHE_LINE_SIZE =
+    std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+#endif
+
+/// Minimum alignment of a packet in a channel's buffer.
+///
+/// With `CHAN_PAD_PACKETS`, every packet takes up whole cache lines, so
+/// threads working on neighboring packets do not contend for the same line.
+#ifdef CHAN_PAD_PACKETS
+inline constexpr std::size_t PACKET_ALIGNMENT = CACHE_LINE_SIZE;
+#else
+inline constexpr std::size_t PACKET_ALIGNMENT = 1;
+#endif
+} // namespace chan::detail
+
+#endif
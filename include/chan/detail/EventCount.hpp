@@ -0,0 +1,142 @@
+#ifndef _CHAN_DETAIL_EVENT_COUNT_H
+#define _CHAN_DETAIL_EVENT_COUNT_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+#include "SemaphoreType.hpp"
+#include "WakerList.hpp"
+
+namespace chan::detail {
+/// Lets threads sleep until a condition becomes true without the notifying
+/// side touching the semaphore unless a thread is actually asleep.
+///
+/// A waiter registers itself in `waiters` before re-checking its condition and
+/// going to sleep. A notifier checks `waiters` after changing the state that
+/// the condition depends on. The sequentially consistent fences on both sides
+/// guarantee that either the waiter sees the new state or the notifier sees the
+/// waiter.
+///
+/// Every registered waiter is eventually accounted for exactly once, either by
+/// unregistering itself or by consuming a semaphore permit released on its
+/// behalf. Permits are not tied to a particular waiter, so a woken thread may
+/// find its condition still false and go back to sleep.
+///
+/// Before registering, a waiter polls its condition for as long as the wait
+/// strategy `W` allows.
+///
+/// `Select` calls and suspended coroutines do not sleep on the semaphore. They
+/// add a waker to `waker_list` instead, and every notification wakes all of
+/// them.
+template <typename W> class EventCount {
+  std::atomic_size_t waiters;
+  SemaphoreType semaphore;
+  WakerList waker_list;
+
+public:
+  EventCount() : waiters(0), semaphore(0) {}
+
+  /// Block until `ready()` returns `true`.
+  ///
+  /// `ready` may have side effects, such as claiming a slot. It is not called
+  /// again after it returns `true`.
+  template <typename F> void wait(const F &ready) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (W::pause(iteration)) {
+        continue;
+      }
+      this->prepare_wait();
+      if (ready()) {
+        this->cancel_wait();
+        return;
+      }
+      this->semaphore.acquire();
+    }
+  }
+
+  /// Block until `ready()` returns `true` or the timeout is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Rep, typename Period>
+  bool wait_for(const F &ready,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    return this->wait_until(ready, std::chrono::steady_clock::now() + timeout);
+  }
+
+  /// Block until `ready()` returns `true` or the deadline is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Clock, typename Duration>
+  bool wait_until(const F &ready,
+                  const std::chrono::time_point<Clock, Duration> &deadline) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (W::pause(iteration)) {
+        if (Clock::now() >= deadline) {
+          return ready();
+        }
+        continue;
+      }
+      this->prepare_wait();
+      if (ready()) {
+        this->cancel_wait();
+        return true;
+      }
+      if (!this->semaphore.try_acquire_until(deadline)) {
+        this->cancel_wait();
+        if (Clock::now() >= deadline) {
+          return ready();
+        }
+      }
+    }
+    return true;
+  }
+
+  /// Wake up to `count` sleeping threads.
+  ///
+  /// Call after changing the state that waiters are checking.
+  void notify(std::size_t count = 1) {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    this->waker_list.wake_all();
+    auto waiters = this->waiters.load(std::memory_order::relaxed);
+    std::size_t woken;
+    do {
+      if (waiters == 0) {
+        return;
+      }
+      woken = std::min(waiters, count);
+    } while (!this->waiters.compare_exchange_weak(waiters, waiters - woken,
+                                                  std::memory_order::relaxed));
+    this->semaphore.release(static_cast<std::ptrdiff_t>(woken));
+  }
+
+  /// Wake all sleeping threads.
+  void notify_all() { this->notify(std::numeric_limits<std::size_t>::max()); }
+
+  /// Wakers waiting for a notification.
+  WakerList &wakers() { return this->waker_list; }
+
+private:
+  void prepare_wait() {
+    this->waiters.fetch_add(1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+  }
+
+  void cancel_wait() {
+    auto waiters = this->waiters.load(std::memory_order::relaxed);
+    while (waiters != 0) {
+      if (this->waiters.compare_exchange_weak(waiters, waiters - 1,
+                                              std::memory_order::relaxed)) {
+        return;
+      }
+    }
+    // A notifier already counted this thread as woken, so its permit is either
+    // available or about to be.
+    this->semaphore.acquire();
+  }
+};
+} // namespace chan::detail
+
+#endif
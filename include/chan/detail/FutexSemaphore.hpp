@@ -0,0 +1,164 @@
+#ifndef _CHAN_DETAIL_FUTEX_SEMAPHORE_H
+#define _CHAN_DETAIL_FUTEX_SEMAPHORE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "cpu_relax.hpp"
+
+namespace chan::detail {
+/// Counting semaphore built directly on the Linux futex system call.
+///
+/// The count lives in a 32-bit atomic that doubles as the futex word.
+/// `release` only makes a system call when `waiters` says a thread is asleep
+/// or about to go to sleep. Before sleeping, `acquire` spins for a while in
+/// case a permit shows up soon. The spin limit adapts to how long recent spins
+/// actually took, like glibc's adaptive mutexes, and is zero on machines with a
+/// single CPU.
+///
+/// Timed waits sleep until an absolute `CLOCK_MONOTONIC` deadline, so spurious
+/// wake-ups never stretch the timeout.
+class FutexSemaphore {
+  static constexpr std::uint32_t MAX_SPIN_COUNT = 1000;
+
+  std::atomic_uint32_t count;
+  std::atomic_uint32_t waiters;
+  std::atomic_uint32_t spin_limit;
+
+  static_assert(sizeof(std::atomic_uint32_t) == sizeof(std::uint32_t) &&
+                std::atomic_uint32_t::is_always_lock_free);
+
+public:
+  explicit FutexSemaphore(std::ptrdiff_t desired)
+      : count(static_cast<std::uint32_t>(desired)), waiters(0),
+        spin_limit(multi_core() ? MAX_SPIN_COUNT / 10 : 0) {}
+
+  void acquire() {
+    if (this->spin()) {
+      return;
+    }
+    this->waiters.fetch_add(1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    while (!this->try_acquire()) {
+      this->futex_wait(nullptr);
+    }
+    this->waiters.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+  bool try_acquire() {
+    auto count = this->count.load(std::memory_order::relaxed);
+    while (count > 0) {
+      if (this->count.compare_exchange_weak(count, count - 1,
+                                            std::memory_order::acquire,
+                                            std::memory_order::relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename Rep, typename Period>
+  bool try_acquire_for(const std::chrono::duration<Rep, Period> &rel_time) {
+    return this->try_acquire_until(std::chrono::steady_clock::now() + rel_time);
+  }
+
+  template <typename Clock, typename Duration>
+  bool
+  try_acquire_until(const std::chrono::time_point<Clock, Duration> &abs_time) {
+    if (this->spin()) {
+      return true;
+    }
+    this->waiters.fetch_add(1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    auto acquired = false;
+    while (!(acquired = this->try_acquire())) {
+      // Other clocks may be adjusted while sleeping, so convert to a
+      // monotonic deadline on every pass and re-check the caller's clock.
+      auto remaining = abs_time - Clock::now();
+      if (remaining <= remaining.zero()) {
+        break;
+      }
+      auto deadline =
+          std::chrono::steady_clock::now() +
+          std::chrono::ceil<std::chrono::steady_clock::duration>(remaining);
+      auto since_epoch = std::chrono::ceil<std::chrono::nanoseconds>(
+          deadline.time_since_epoch());
+      auto seconds = std::chrono::floor<std::chrono::seconds>(since_epoch);
+      timespec timeout{
+          static_cast<std::time_t>(seconds.count()),
+          static_cast<long>((since_epoch - seconds).count()),
+      };
+      this->futex_wait(&timeout);
+    }
+    this->waiters.fetch_sub(1, std::memory_order::relaxed);
+    return acquired;
+  }
+
+  void release(std::ptrdiff_t update = 1) {
+    this->count.fetch_add(static_cast<std::uint32_t>(update),
+                          std::memory_order::release);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (this->waiters.load(std::memory_order::relaxed) == 0) {
+      return;
+    }
+    auto woken = std::min<std::ptrdiff_t>(update, INT_MAX);
+    syscall(SYS_futex, this->futex_word(), FUTEX_WAKE_PRIVATE,
+            static_cast<int>(woken), nullptr, nullptr, 0);
+  }
+
+private:
+  static bool multi_core() {
+    static const bool multi_core = std::thread::hardware_concurrency() > 1;
+    return multi_core;
+  }
+
+  /// Try to acquire a permit for up to twice the current spin limit.
+  ///
+  /// Moves the spin limit an eighth of the way towards the number of
+  /// iterations this attempt took.
+  bool spin() {
+    auto spin_limit = this->spin_limit.load(std::memory_order::relaxed);
+    if (spin_limit == 0) {
+      return this->try_acquire();
+    }
+    auto max_spin_count = std::min(2 * spin_limit + 10, MAX_SPIN_COUNT);
+    std::uint32_t spin_count = 0;
+    auto acquired = false;
+    while (!(acquired = this->try_acquire()) && spin_count < max_spin_count) {
+      cpu_relax();
+      ++spin_count;
+    }
+    auto adjusted = static_cast<std::int32_t>(spin_limit) +
+                    (static_cast<std::int32_t>(spin_count) -
+                     static_cast<std::int32_t>(spin_limit)) /
+                        8;
+    this->spin_limit.store(static_cast<std::uint32_t>(std::max(adjusted, 1)),
+                           std::memory_order::relaxed);
+    return acquired;
+  }
+
+  /// Sleep while the count is zero, until woken, interrupted or `timeout`
+  /// (an absolute `CLOCK_MONOTONIC` time) passes.
+  void futex_wait(const timespec *timeout) {
+    // `FUTEX_WAIT_BITSET` takes an absolute timeout, unlike `FUTEX_WAIT`.
+    syscall(SYS_futex, this->futex_word(), FUTEX_WAIT_BITSET_PRIVATE, 0,
+            timeout, nullptr, FUTEX_BITSET_MATCH_ANY);
+  }
+
+  std::uint32_t *futex_word() {
+    return reinterpret_cast<std::uint32_t *>(&this->count);
+  }
+};
+} // namespace chan::detail
+
+#endif
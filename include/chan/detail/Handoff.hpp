@@ -0,0 +1,131 @@
+#ifndef _CHAN_DETAIL_HANDOFF_H
+#define _CHAN_DETAIL_HANDOFF_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "SemaphoreType.hpp"
+#include "backoff.hpp"
+
+namespace chan::detail {
+/// A thread blocked in an unbuffered channel's `send` or `recv`, waiting for a
+/// thread on the other side to take or fill `item`.
+///
+/// Each waiter parks on its own semaphore, so completing a handoff wakes
+/// exactly the thread it is meant for. The waiter first spins on `state` for
+/// as long as the wait strategy allows, and the completing thread only touches
+/// the semaphore if the waiter actually went to sleep.
+///
+/// A `Handoff` lives on the waiter's stack. A waiter that went to sleep
+/// therefore also waits for `state` to become `RELEASED`, which the completing
+/// thread stores after its last use of the semaphore.
+template <typename T> class Handoff {
+  static constexpr std::uint32_t WAITING = 0;
+  static constexpr std::uint32_t PARKED = 1;
+  static constexpr std::uint32_t DONE = 2;
+  static constexpr std::uint32_t RELEASED = 3;
+
+public:
+  /// Item being sent, or the item received once the handoff is done.
+  std::optional<T> item;
+
+  /// Links in the channel's `HandoffList`, guarded by its `packet_mutex`.
+  Handoff *prev;
+  Handoff *next;
+  bool linked;
+
+private:
+  std::atomic_uint32_t state;
+  SemaphoreType semaphore;
+
+public:
+  Handoff()
+      : prev(nullptr), next(nullptr), linked(false), state(WAITING),
+        semaphore(0) {}
+
+  explicit Handoff(T item)
+      : item(std::move(item)), prev(nullptr), next(nullptr), linked(false),
+        state(WAITING), semaphore(0) {}
+
+  /// Wake the waiter after taking or filling `item`, or leaving it alone if
+  /// the other side disconnected.
+  ///
+  /// The `Handoff` must already be unlinked, and must not be touched after
+  /// this returns.
+  void complete() {
+    if (this->state.exchange(DONE, std::memory_order::acq_rel) == PARKED) {
+      this->semaphore.release();
+      this->state.store(RELEASED, std::memory_order::release);
+    }
+  }
+
+  /// Block until `complete()` is called.
+  template <typename W> void wait() {
+    for (std::size_t iteration = 0; !this->done(); ++iteration) {
+      if (!W::pause(iteration)) {
+        if (this->park()) {
+          this->semaphore.acquire();
+          this->wait_released<W>();
+        }
+        return;
+      }
+    }
+  }
+
+  /// Block until `complete()` is called or the deadline is met.
+  ///
+  /// Returns `false` if the deadline was met first. The caller must then
+  /// unlink `this`, or call `finish()` if another thread already did.
+  template <typename W, typename Clock, typename Duration>
+  bool wait_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    for (std::size_t iteration = 0; !this->done(); ++iteration) {
+      if (!W::pause(iteration) || Clock::now() >= deadline) {
+        if (!this->park()) {
+          return true;
+        }
+        if (!this->semaphore.try_acquire_until(deadline)) {
+          return false;
+        }
+        this->wait_released<W>();
+        return true;
+      }
+    }
+    return true;
+  }
+
+  /// Finish a wait that timed out after another thread unlinked `this` and is
+  /// about to call `complete()`.
+  template <typename W> void finish() {
+    this->semaphore.acquire();
+    this->wait_released<W>();
+  }
+
+private:
+  bool done() const {
+    return this->state.load(std::memory_order::acquire) != WAITING;
+  }
+
+  /// Announce that the waiter is going to sleep. Returns `false` if the
+  /// handoff is already done.
+  bool park() {
+    auto state = WAITING;
+    return this->state.compare_exchange_strong(state, PARKED,
+                                               std::memory_order::acq_rel,
+                                               std::memory_order::acquire);
+  }
+
+  template <typename W> void wait_released() {
+    for (std::size_t iteration = 0;
+         this->state.load(std::memory_order::acquire) != RELEASED;
+         ++iteration) {
+      backoff<W>(iteration);
+    }
+  }
+};
+} // namespace chan::detail
+
+#endif
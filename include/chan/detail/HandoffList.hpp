@@ -0,0 +1,65 @@
+#ifndef _CHAN_DETAIL_HANDOFF_LIST_H
+#define _CHAN_DETAIL_HANDOFF_LIST_H
+
+#include "Handoff.hpp"
+
+namespace chan::detail {
+/// First-in first-out list of the `Handoff`s waiting on one side of an
+/// unbuffered channel.
+///
+/// The links live in the `Handoff`s themselves, so nothing is allocated and a
+/// waiter that times out unlinks itself in constant time.
+template <typename T> class HandoffList {
+  Handoff<T> *head;
+  Handoff<T> *tail;
+
+public:
+  HandoffList() : head(nullptr), tail(nullptr) {}
+
+  bool empty() const { return this->head == nullptr; }
+
+  void push_back(Handoff<T> &handoff) {
+    handoff.prev = this->tail;
+    handoff.next = nullptr;
+    handoff.linked = true;
+    if (this->tail) {
+      this->tail->next = &handoff;
+    } else {
+      this->head = &handoff;
+    }
+    this->tail = &handoff;
+  }
+
+  /// Unlink and return the oldest `Handoff`, or `nullptr` if the list is empty.
+  Handoff<T> *pop_front() {
+    auto handoff = this->head;
+    if (handoff) {
+      this->remove(*handoff);
+    }
+    return handoff;
+  }
+
+  /// Unlink `handoff` if it is still linked.
+  ///
+  /// Returns `false` if another thread already unlinked it.
+  bool remove(Handoff<T> &handoff) {
+    if (!handoff.linked) {
+      return false;
+    }
+    if (handoff.prev) {
+      handoff.prev->next = handoff.next;
+    } else {
+      this->head = handoff.next;
+    }
+    if (handoff.next) {
+      handoff.next->prev = handoff.prev;
+    } else {
+      this->tail = handoff.prev;
+    }
+    handoff.linked = false;
+    return true;
+  }
+};
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,302 @@
+#ifndef _CHAN_DETAIL_OVERWRITING_CHANNEL_H
+#define _CHAN_DETAIL_OVERWRITING_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../SendRangeResult.hpp"
+#include "../TryRecvError.hpp"
+#include "backoff.hpp"
+
+namespace chan::detail {
+/// Operations for a bounded `Chan` whose senders never wait for room and
+/// instead drop the oldest item when the channel is full.
+///
+/// `head_index` and `tail_index` are positions that only ever increase. A
+/// packet's sequence number is `2 * p` when it is free for the sender of
+/// position `p` and `2 * p + 1` when it holds that sender's item. The receiver
+/// claims the item at the head by moving `head_index` past it with a
+/// compare-exchange. A sender that finds its packet still holding the item
+/// from the previous lap claims the head the same way and destroys that item
+/// instead, so it is always the oldest item that gets dropped. Whoever claims a
+/// position frees its packet for the next lap.
+///
+/// A sender only waits for another thread to finish a step it has already
+/// started: the sender of an older position filling its packet, or the
+/// receiver moving an item out.
+///
+/// `Self` provides `claim_tail(n)`, which reserves `n` consecutive positions
+/// for the calling sender and returns the first one.
+template <typename Self, typename T, typename W, typename A>
+struct OverwritingChannel {
+  std::expected<void, SendError<T>> send(T item) {
+    auto self = static_cast<Self *>(this);
+    if (self->recv_done()) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    this->put(self->claim_tail(1), std::move(item));
+    self->recv_ready.notify();
+    return {};
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    auto self = static_cast<Self *>(this);
+    if (self->recv_done()) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    auto index = self->claim_tail(n);
+    for (std::size_t count = 0; count != n; ++count, ++first) {
+      this->put(index + count, std::ranges::iter_move(first));
+    }
+    self->recv_ready.notify();
+    return {std::move(first), n, false};
+  }
+
+  std::expected<T, RecvError> recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_once(item, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return std::move(*item);
+  }
+
+  std::expected<T, TryRecvError> try_recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    this->try_recv_once(item, disconnected);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_for(
+        [&] { return this->try_recv_once(item, disconnected); }, timeout);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError>
+  try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_until(
+        [&] { return this->try_recv_once(item, disconnected); }, deadline);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_n_once(out, n, received, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    this->try_recv_n_once(out, n, received, disconnected);
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (received == 0) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return received;
+  }
+
+  /// Number of items dropped since the last call.
+  std::size_t take_dropped_count() {
+    return static_cast<Self *>(this)->dropped_count.exchange(
+        0, std::memory_order::relaxed);
+  }
+
+private:
+  /// Fill the packet for position `index`, dropping the oldest items until it
+  /// is free.
+  template <typename U> void put(std::size_t index, U &&item) {
+    auto self = static_cast<Self *>(this);
+    auto &packet = self->packet_buffer[index % self->capacity];
+    for (std::size_t iteration = 0;
+         packet.sequence.load(std::memory_order::acquire) != 2 * index;
+         ++iteration) {
+      if (!this->try_drop(index - self->capacity)) {
+        backoff<W>(iteration);
+      }
+    }
+    std::allocator_traits<A>::construct(self->allocator, &packet.item,
+                                        std::forward<U>(item));
+    packet.sequence.store(2 * index + 1, std::memory_order::release);
+  }
+
+  /// Drop the item at the head if it is at or before position `last`.
+  ///
+  /// Returns `false` if there is nothing to do but wait for another thread,
+  /// either because the head is already past `last` and its packet is still
+  /// being emptied, or because the head item is still being filled.
+  bool try_drop(std::size_t last) {
+    auto self = static_cast<Self *>(this);
+    auto head_index = self->head_index.load(std::memory_order::relaxed);
+    if (head_index > last) {
+      return false;
+    }
+    auto &packet = self->packet_buffer[head_index % self->capacity];
+    if (packet.sequence.load(std::memory_order::acquire) !=
+        2 * head_index + 1) {
+      return false;
+    }
+    if (self->head_index.compare_exchange_strong(head_index, head_index + 1,
+                                                 std::memory_order::relaxed)) {
+      std::allocator_traits<A>::destroy(self->allocator, &packet.item);
+      packet.sequence.store(2 * (head_index + self->capacity),
+                            std::memory_order::release);
+      self->dropped_count.fetch_add(1, std::memory_order::relaxed);
+    }
+    return true;
+  }
+
+  std::optional<T> try_do_recv() {
+    auto self = static_cast<Self *>(this);
+    auto head_index = self->head_index.load(std::memory_order::relaxed);
+    while (true) {
+      auto &packet = self->packet_buffer[head_index % self->capacity];
+      auto sequence = packet.sequence.load(std::memory_order::acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - (2 * head_index + 1));
+      if (lag == 0) {
+        if (self->head_index.compare_exchange_weak(
+                head_index, head_index + 1, std::memory_order::relaxed)) {
+          std::optional<T> item(std::move(packet.item));
+          std::allocator_traits<A>::destroy(self->allocator, &packet.item);
+          packet.sequence.store(2 * (head_index + self->capacity),
+                                std::memory_order::release);
+          return item;
+        }
+      } else if (lag < 0) {
+        // No sender has filled the packet for this position yet.
+        return {};
+      } else {
+        head_index = self->head_index.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    auto self = static_cast<Self *>(this);
+    n = std::min(n, self->capacity);
+    auto head_index = self->head_index.load(std::memory_order::relaxed);
+    while (true) {
+      // Count the filled packets in a row starting at the head. Senders that
+      // drop items also move the head, so the claim can fail and has to be
+      // counted again.
+      std::size_t claimed = 0;
+      std::ptrdiff_t lag = 0;
+      while (claimed < n) {
+        auto index = head_index + claimed;
+        auto sequence = self->packet_buffer[index % self->capacity]
+                            .sequence.load(std::memory_order::acquire);
+        lag = static_cast<std::ptrdiff_t>(sequence - (2 * index + 1));
+        if (lag != 0) {
+          break;
+        }
+        ++claimed;
+      }
+      if (claimed == 0) {
+        if (lag < 0) {
+          return 0;
+        }
+        head_index = self->head_index.load(std::memory_order::relaxed);
+        continue;
+      }
+      if (self->head_index.compare_exchange_weak(head_index,
+                                                 head_index + claimed,
+                                                 std::memory_order::relaxed)) {
+        for (std::size_t offset = 0; offset < claimed; ++offset, ++out) {
+          auto index = head_index + offset;
+          auto &packet = self->packet_buffer[index % self->capacity];
+          *out = std::move(packet.item);
+          std::allocator_traits<A>::destroy(self->allocator, &packet.item);
+          packet.sequence.store(2 * (index + self->capacity),
+                                std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  /// Returns `true` when the operation is finished, either because an item
+  /// was received or because the channel is empty and there are no remaining
+  /// senders.
+  bool try_recv_once(std::optional<T> &item, bool &disconnected) {
+    item = this->try_do_recv();
+    if (item) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      // Senders may have finished sending between the failed claim and the
+      // `send_done` check, so check one more time.
+      item = this->try_do_recv();
+      disconnected = !item;
+      return true;
+    }
+    return false;
+  }
+
+  /// Same as `try_recv_once`, but claims up to `n` items at once.
+  template <typename O>
+  bool try_recv_n_once(O &out, std::size_t n, std::size_t &received,
+                       bool &disconnected) {
+    received = this->try_do_recv_n(out, n);
+    if (received != 0) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      received = this->try_do_recv_n(out, n);
+      disconnected = received == 0;
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<T, TryRecvError> try_recv_impl(std::optional<T> &item,
+                                               bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!item) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return std::move(*item);
+  }
+};
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef _CHAN_DETAIL_PRIORITY_CHANNEL_H
+#define _CHAN_DETAIL_PRIORITY_CHANNEL_H
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <expected>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../SendRangeResult.hpp"
+#include "../TryRecvError.hpp"
+
+namespace chan::detail {
+/// Operations for an unbounded `Chan` that keeps a queue of items for each of
+/// `LEVELS` priorities and always receives from the highest one that is not
+/// empty.
+///
+/// Every queue is guarded by the same mutex, so a receiver sees all of them at
+/// once and never takes an item while one of a higher priority is waiting.
+/// `item_count` is only changed with the mutex held, but it can be read
+/// without it, so receiving from an empty channel does not take the mutex.
+///
+/// All priorities share one `EventCount`, so a blocked receiver wakes up for
+/// an item of any priority.
+template <typename Self, typename T, std::size_t LEVELS, typename A>
+struct PriorityChannel {
+  using Queue = std::deque<T, A>;
+
+  static std::array<Queue, LEVELS> make_queues(const A &allocator) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::array<Queue, LEVELS>{((void)I, Queue(allocator))...};
+    }(std::make_index_sequence<LEVELS>());
+  }
+
+  std::expected<void, SendError<T>> send(T item, std::size_t priority) {
+    auto self = static_cast<Self *>(this);
+    assert(priority < LEVELS);
+    if (self->recv_done()) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    {
+      std::lock_guard lock(self->mutex);
+      self->queues[priority].push_back(std::move(item));
+      self->item_count.fetch_add(1, std::memory_order::relaxed);
+    }
+    self->recv_ready.notify();
+    return {};
+  }
+
+  template <typename I>
+  SendRangeResult<I> send_n(I first, std::size_t n, std::size_t priority) {
+    auto self = static_cast<Self *>(this);
+    assert(priority < LEVELS);
+    if (self->recv_done()) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    {
+      std::lock_guard lock(self->mutex);
+      auto &queue = self->queues[priority];
+      for (std::size_t count = 0; count != n; ++count, ++first) {
+        queue.push_back(std::ranges::iter_move(first));
+      }
+      self->item_count.fetch_add(n, std::memory_order::relaxed);
+    }
+    self->recv_ready.notify(n);
+    return {std::move(first), n, false};
+  }
+
+  std::expected<T, RecvError> recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_once(item, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return std::move(*item);
+  }
+
+  std::expected<T, TryRecvError> try_recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    this->try_recv_once(item, disconnected);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_for(
+        [&] { return this->try_recv_once(item, disconnected); }, timeout);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError>
+  try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::optional<T> item;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait_until(
+        [&] { return this->try_recv_once(item, disconnected); }, deadline);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    static_cast<Self *>(this)->recv_ready.wait(
+        [&] { return this->try_recv_n_once(out, n, received, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    std::size_t received = 0;
+    auto disconnected = false;
+    this->try_recv_n_once(out, n, received, disconnected);
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (received == 0) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return received;
+  }
+
+  std::size_t size() const {
+    return static_cast<const Self *>(this)->item_count.load(
+        std::memory_order::relaxed);
+  }
+
+private:
+  std::optional<T> try_do_recv() {
+    auto self = static_cast<Self *>(this);
+    if (self->item_count.load(std::memory_order::relaxed) == 0) {
+      return {};
+    }
+    std::lock_guard lock(self->mutex);
+    for (auto queue = self->queues.rbegin(); queue != self->queues.rend();
+         ++queue) {
+      if (!queue->empty()) {
+        std::optional<T> item(std::move(queue->front()));
+        queue->pop_front();
+        self->item_count.fetch_sub(1, std::memory_order::relaxed);
+        return item;
+      }
+    }
+    return {};
+  }
+
+  /// Move up to `n` items to `out`, highest priority first.
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    auto self = static_cast<Self *>(this);
+    if (self->item_count.load(std::memory_order::relaxed) == 0) {
+      return 0;
+    }
+    std::lock_guard lock(self->mutex);
+    std::size_t received = 0;
+    for (auto queue = self->queues.rbegin();
+         queue != self->queues.rend() && received != n; ++queue) {
+      for (; !queue->empty() && received != n; ++received, ++out) {
+        *out = std::move(queue->front());
+        queue->pop_front();
+      }
+    }
+    self->item_count.fetch_sub(received, std::memory_order::relaxed);
+    return received;
+  }
+
+  /// Returns `true` when the operation is finished, either because an item
+  /// was received or because the channel is empty and there are no remaining
+  /// senders.
+  bool try_recv_once(std::optional<T> &item, bool &disconnected) {
+    item = this->try_do_recv();
+    if (item) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      // Senders may have finished sending between the failed receive and the
+      // `send_done` check, so check one more time.
+      item = this->try_do_recv();
+      disconnected = !item;
+      return true;
+    }
+    return false;
+  }
+
+  /// Same as `try_recv_once`, but receives up to `n` items at once.
+  template <typename O>
+  bool try_recv_n_once(O &out, std::size_t n, std::size_t &received,
+                       bool &disconnected) {
+    received = this->try_do_recv_n(out, n);
+    if (received != 0) {
+      return true;
+    }
+    if (static_cast<Self *>(this)->send_done()) {
+      received = this->try_do_recv_n(out, n);
+      disconnected = received == 0;
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<T, TryRecvError> try_recv_impl(std::optional<T> &item,
+                                               bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!item) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return std::move(*item);
+  }
+};
+} // namespace chan::detail
+
+#endif
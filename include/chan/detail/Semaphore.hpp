@@ -0,0 +1,98 @@
+#ifndef _CHAN_DETAIL_SEMAPHORE_H
+#define _CHAN_DETAIL_SEMAPHORE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "EventCount.hpp"
+#include "WakerList.hpp"
+
+namespace chan::detail {
+/// Counting semaphore that keeps its count in an atomic and only touches the
+/// underlying `SemaphoreType` when a thread is asleep.
+///
+/// `std::counting_semaphore::release` may issue a wake-up system call every
+/// time the count goes up from zero, even when nobody is waiting. Here
+/// `release` is an atomic add followed by a check of the event count's
+/// waiters, so the steady state never enters the kernel.
+///
+/// Unlike `std::counting_semaphore`, `try_acquire` does not spuriously fail.
+/// Blocked threads wait according to the wait strategy `W`.
+template <typename W> class Semaphore {
+  std::atomic_ptrdiff_t count;
+  EventCount<W> ready;
+
+public:
+  explicit Semaphore(std::ptrdiff_t desired) : count(desired) {}
+
+  void acquire() {
+    this->ready.wait([this] { return this->try_acquire(); });
+  }
+
+  bool try_acquire() {
+    auto count = this->count.load(std::memory_order::relaxed);
+    while (count > 0) {
+      if (this->count.compare_exchange_weak(count, count - 1,
+                                            std::memory_order::acquire,
+                                            std::memory_order::relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Acquire between 1 and `max` permits, blocking until at least one is
+  /// available.
+  ///
+  /// Returns the number of permits acquired.
+  std::ptrdiff_t acquire_many(std::ptrdiff_t max) {
+    std::ptrdiff_t acquired;
+    this->ready.wait([&] {
+      acquired = this->try_acquire_many(max);
+      return acquired != 0;
+    });
+    return acquired;
+  }
+
+  /// Acquire up to `max` permits without blocking.
+  ///
+  /// Returns the number of permits acquired.
+  std::ptrdiff_t try_acquire_many(std::ptrdiff_t max) {
+    auto count = this->count.load(std::memory_order::relaxed);
+    while (count > 0) {
+      auto acquired = std::min(count, max);
+      if (this->count.compare_exchange_weak(count, count - acquired,
+                                            std::memory_order::acquire,
+                                            std::memory_order::relaxed)) {
+        return acquired;
+      }
+    }
+    return 0;
+  }
+
+  template <typename Rep, typename Period>
+  bool try_acquire_for(const std::chrono::duration<Rep, Period> &rel_time) {
+    return this->ready.wait_for([this] { return this->try_acquire(); },
+                                rel_time);
+  }
+
+  template <typename Clock, typename Duration>
+  bool
+  try_acquire_until(const std::chrono::time_point<Clock, Duration> &abs_time) {
+    return this->ready.wait_until([this] { return this->try_acquire(); },
+                                  abs_time);
+  }
+
+  void release(std::ptrdiff_t update = 1) {
+    this->count.fetch_add(update, std::memory_order::release);
+    this->ready.notify(static_cast<std::size_t>(update));
+  }
+
+  /// Wakers waiting for a permit.
+  WakerList &wakers() { return this->ready.wakers(); }
+};
+} // namespace chan::detail
+
+#endif
@@ -1,7 +1,15 @@
 #ifndef _CHAN_DETAIL_SEMAPHORE_TYPE_H
 #define _CHAN_DETAIL_SEMAPHORE_TYPE_H
 
-#ifdef CHAN_REPLACE_SEMAPHORE_WITH_CONDITION_VARIABLE
+#if defined(CHAN_USE_FUTEX_SEMAPHORE)
+#ifndef __linux__
+#error "CHAN_USE_FUTEX_SEMAPHORE is only supported on Linux"
+#endif
+#include "FutexSemaphore.hpp"
+namespace chan::detail {
+using SemaphoreType = FutexSemaphore;
+}
+#elif defined(CHAN_REPLACE_SEMAPHORE_WITH_CONDITION_VARIABLE)
 #include "CvarSemaphore.hpp"
 namespace chan::detail {
 using SemaphoreType = CvarSemaphore;
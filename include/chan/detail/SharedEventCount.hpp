@@ -0,0 +1,145 @@
+#ifndef _CHAN_DETAIL_SHARED_EVENT_COUNT_H
+#define _CHAN_DETAIL_SHARED_EVENT_COUNT_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace chan::detail {
+/// `EventCount` for threads in different processes that map the same memory.
+///
+/// Lives entirely in the shared memory, so it holds no pointers and no
+/// process-local semaphore. Sleeping threads wait on `epoch` with a futex
+/// that is not process-private. A waiter reads `epoch` before registering in
+/// `waiters` and re-checking its condition, and a notifier that sees a waiter
+/// bumps `epoch` before waking, so a wake-up that lands between the re-check
+/// and the futex call makes the futex call return right away.
+///
+/// Before registering, a waiter polls its condition for as long as the wait
+/// strategy `W` allows.
+template <typename W> class SharedEventCount {
+  std::atomic_uint32_t epoch;
+  std::atomic_uint32_t waiters;
+
+  static_assert(sizeof(std::atomic_uint32_t) == sizeof(std::uint32_t) &&
+                std::atomic_uint32_t::is_always_lock_free);
+
+public:
+  SharedEventCount() : epoch(0), waiters(0) {}
+
+  /// Block until `ready()` returns `true`.
+  ///
+  /// `ready` may have side effects, such as claiming a slot. It is not called
+  /// again after it returns `true`.
+  template <typename F> void wait(const F &ready) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (W::pause(iteration)) {
+        continue;
+      }
+      auto epoch = this->prepare_wait();
+      if (ready()) {
+        this->waiters.fetch_sub(1, std::memory_order::relaxed);
+        return;
+      }
+      this->futex_wait(epoch, nullptr);
+      this->waiters.fetch_sub(1, std::memory_order::relaxed);
+    }
+  }
+
+  /// Block until `ready()` returns `true` or the timeout is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Rep, typename Period>
+  bool wait_for(const F &ready,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    return this->wait_until(ready, std::chrono::steady_clock::now() + timeout);
+  }
+
+  /// Block until `ready()` returns `true` or the deadline is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Clock, typename Duration>
+  bool wait_until(const F &ready,
+                  const std::chrono::time_point<Clock, Duration> &deadline) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (Clock::now() >= deadline) {
+        return ready();
+      }
+      if (W::pause(iteration)) {
+        continue;
+      }
+      auto epoch = this->prepare_wait();
+      if (ready()) {
+        this->waiters.fetch_sub(1, std::memory_order::relaxed);
+        return true;
+      }
+      // Other clocks may be adjusted while sleeping, so convert to a monotonic
+      // deadline on every pass and re-check the caller's clock.
+      auto remaining = deadline - Clock::now();
+      if (remaining > remaining.zero()) {
+        auto since_epoch = std::chrono::ceil<std::chrono::nanoseconds>(
+            (std::chrono::steady_clock::now() +
+             std::chrono::ceil<std::chrono::steady_clock::duration>(remaining))
+                .time_since_epoch());
+        auto seconds = std::chrono::floor<std::chrono::seconds>(since_epoch);
+        timespec timeout{
+            static_cast<std::time_t>(seconds.count()),
+            static_cast<long>((since_epoch - seconds).count()),
+        };
+        this->futex_wait(epoch, &timeout);
+      }
+      this->waiters.fetch_sub(1, std::memory_order::relaxed);
+    }
+    return true;
+  }
+
+  /// Wake up to `count` sleeping threads.
+  ///
+  /// Call after changing the state that waiters are checking.
+  void notify(std::size_t count = 1) {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (this->waiters.load(std::memory_order::relaxed) == 0) {
+      return;
+    }
+    this->epoch.fetch_add(1, std::memory_order::release);
+    auto woken = std::min<std::size_t>(count, INT_MAX);
+    syscall(SYS_futex, this->futex_word(), FUTEX_WAKE, static_cast<int>(woken),
+            nullptr, nullptr, 0);
+  }
+
+  /// Wake all sleeping threads.
+  void notify_all() { this->notify(std::numeric_limits<std::size_t>::max()); }
+
+private:
+  /// Register as a waiter and return the `epoch` to sleep on.
+  std::uint32_t prepare_wait() {
+    auto epoch = this->epoch.load(std::memory_order::acquire);
+    this->waiters.fetch_add(1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    return epoch;
+  }
+
+  /// Sleep while `epoch` is unchanged, until woken, interrupted or `timeout`
+  /// (an absolute `CLOCK_MONOTONIC` time) passes.
+  void futex_wait(std::uint32_t epoch, const timespec *timeout) {
+    // `FUTEX_WAIT_BITSET` takes an absolute timeout, unlike `FUTEX_WAIT`.
+    syscall(SYS_futex, this->futex_word(), FUTEX_WAIT_BITSET, epoch, timeout,
+            nullptr, FUTEX_BITSET_MATCH_ANY);
+  }
+
+  std::uint32_t *futex_word() {
+    return reinterpret_cast<std::uint32_t *>(&this->epoch);
+  }
+};
+} // namespace chan::detail
+
+#endif
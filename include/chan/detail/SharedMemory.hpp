@@ -0,0 +1,107 @@
+#ifndef _CHAN_DETAIL_SHARED_MEMORY_H
+#define _CHAN_DETAIL_SHARED_MEMORY_H
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chan::detail {
+/// POSIX shared memory object mapped into this process.
+///
+/// Unmaps the memory when destroyed. The object itself stays until it is
+/// unlinked and every process has unmapped it.
+class SharedMemory {
+  void *address;
+  std::size_t length;
+
+public:
+  /// Create a new shared memory object of `size` bytes and map it.
+  ///
+  /// Fails if an object named `name` already exists. The memory is zeroed.
+  static SharedMemory create(const std::string &name, std::size_t size) {
+    auto fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1) {
+      throw_error("shm_open");
+    }
+    if (::ftruncate(fd, static_cast<off_t>(size)) == -1) {
+      auto error = errno;
+      ::close(fd);
+      ::shm_unlink(name.c_str());
+      throw_error("ftruncate", error);
+    }
+    try {
+      return SharedMemory(fd, size);
+    } catch (...) {
+      ::shm_unlink(name.c_str());
+      throw;
+    }
+  }
+
+  /// Map the existing shared memory object named `name`.
+  static SharedMemory open(const std::string &name) {
+    auto fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+      throw_error("shm_open");
+    }
+    struct stat status;
+    if (::fstat(fd, &status) == -1) {
+      auto error = errno;
+      ::close(fd);
+      throw_error("fstat", error);
+    }
+    return SharedMemory(fd, static_cast<std::size_t>(status.st_size));
+  }
+
+  /// Remove the name of a shared memory object, so it can't be opened again.
+  static void unlink(const std::string &name) { ::shm_unlink(name.c_str()); }
+
+  ~SharedMemory() {
+    if (this->address != nullptr) {
+      ::munmap(this->address, this->length);
+    }
+  }
+
+  SharedMemory(SharedMemory &&other)
+      : address(std::exchange(other.address, nullptr)), length(other.length) {}
+
+  SharedMemory &operator=(SharedMemory &&other) {
+    std::swap(this->address, other.address);
+    std::swap(this->length, other.length);
+    return *this;
+  }
+
+  SharedMemory(const SharedMemory &) = delete;
+  SharedMemory &operator=(const SharedMemory &) = delete;
+
+  void *data() const { return this->address; }
+
+  std::size_t size() const { return this->length; }
+
+private:
+  /// Map `size` bytes of `fd` and close it.
+  SharedMemory(int fd, std::size_t size) : address(nullptr), length(size) {
+    auto address = size == 0 ? MAP_FAILED
+                             : ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                      MAP_SHARED, fd, 0);
+    auto error = size == 0 ? EINVAL : errno;
+    ::close(fd);
+    if (address == MAP_FAILED) {
+      throw_error("mmap", error);
+    }
+    this->address = address;
+  }
+
+  [[noreturn]] static void throw_error(const char *what, int error = errno) {
+    throw std::system_error(error, std::system_category(), what);
+  }
+};
+} // namespace chan::detail
+
+#endif
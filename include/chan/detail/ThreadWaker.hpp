@@ -0,0 +1,53 @@
+#ifndef _CHAN_DETAIL_THREAD_WAKER_H
+#define _CHAN_DETAIL_THREAD_WAKER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "Waker.hpp"
+
+namespace chan::detail {
+/// Lets a `Select` sleep until one of the channels it waits on wakes it.
+///
+/// A wake-up is remembered until the next wait consumes it, so waking before
+/// the `Select` goes to sleep is never lost.
+class ThreadWaker final : public Waker {
+  std::mutex mutex;
+  std::condition_variable ready;
+  bool woken;
+
+public:
+  ThreadWaker() : woken(false) {}
+
+  void wake() override {
+    {
+      std::lock_guard _lock(this->mutex);
+      this->woken = true;
+    }
+    this->ready.notify_one();
+  }
+
+  void wait() {
+    std::unique_lock lock(this->mutex);
+    this->ready.wait(lock, [this] { return this->woken; });
+    this->woken = false;
+  }
+
+  /// Block until woken or the deadline is met.
+  ///
+  /// Returns `false` if the deadline was met first.
+  template <typename Clock, typename Duration>
+  bool wait_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::unique_lock lock(this->mutex);
+    if (!this->ready.wait_until(lock, deadline,
+                                [this] { return this->woken; })) {
+      return false;
+    }
+    this->woken = false;
+    return true;
+  }
+};
+} // namespace chan::detail
+
+#endif
@@ -1,7 +1,10 @@
 #ifndef _CHAN_DETAIL_UNBOUNDED_CHANNEL_H
 #define _CHAN_DETAIL_UNBOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <expected>
 
 #include "../RecvError.hpp"
@@ -49,7 +52,89 @@ template <typename Self, typename T> struct UnboundedChannel {
     });
   }
 
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    auto received = this->recv_n_impl(out, n, [&](std::size_t max) {
+      return static_cast<Self *>(this)->recv_ready.acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+    });
+    if (received == 0 && n != 0) {
+      return std::unexpected(RecvError{});
+    }
+    return received;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    auto empty = false;
+    auto received = this->recv_n_impl(out, n, [&](std::size_t max) {
+      auto permits = static_cast<Self *>(this)->recv_ready.try_acquire_many(
+          static_cast<std::ptrdiff_t>(max));
+      empty = permits == 0;
+      return permits;
+    });
+    if (received == 0 && n != 0) {
+      return std::unexpected(TryRecvError{
+          empty ? TryRecvErrorKind::Empty : TryRecvErrorKind::Disconnected});
+    }
+    return received;
+  }
+
+  /// Claim the next item like `recv`, but leave it in its slot.
+  /// `Self::do_peek` returns an empty `std::optional` if the channel is empty.
+  auto peek() {
+    using Result = std::expected<typename Self::Slot, RecvError>;
+    if (!static_cast<Self *>(this)->send_done()) {
+      static_cast<Self *>(this)->recv_ready.acquire();
+    }
+    auto slot = static_cast<Self *>(this)->do_peek();
+    if (!slot) {
+      return Result(std::unexpected(RecvError{}));
+    }
+    return Result(*slot);
+  }
+
+  auto try_peek() {
+    using Result = std::expected<typename Self::Slot, TryRecvError>;
+    if (!static_cast<Self *>(this)->send_done() &&
+        !static_cast<Self *>(this)->recv_ready.try_acquire()) {
+      return Result(std::unexpected(TryRecvError{TryRecvErrorKind::Empty}));
+    }
+    auto slot = static_cast<Self *>(this)->do_peek();
+    if (!slot) {
+      return Result(
+          std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected}));
+    }
+    return Result(*slot);
+  }
+
 private:
+  /// Take up to `n` items with a single claim. Returns 0 if the channel is
+  /// empty and there are no remaining senders.
+  template <typename O, typename F>
+  std::size_t recv_n_impl(O &out, std::size_t n, const F &acquire) {
+    if (n == 0) {
+      return 0;
+    }
+    n = std::min(n, static_cast<std::size_t>(PTRDIFF_MAX));
+    if (!static_cast<Self *>(this)->send_done()) {
+      auto permits = static_cast<std::size_t>(acquire(n));
+      if (permits == 0) {
+        return 0;
+      }
+      auto received = static_cast<Self *>(this)->do_recv_n(out, permits);
+      if (received != permits) {
+        // The extra permits were released for disconnecting senders, and
+        // other receivers may be waiting on them.
+        static_cast<Self *>(this)->recv_ready.release(
+            static_cast<std::ptrdiff_t>(permits - received));
+      }
+      return received;
+    } else {
+      return static_cast<Self *>(this)->do_recv_n(out, n);
+    }
+  }
+
   template <typename F>
   std::expected<T, TryRecvError> try_recv_impl(const F &acquire) {
     if (!static_cast<Self *>(this)->send_done()) {
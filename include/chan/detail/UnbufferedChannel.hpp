@@ -2,177 +2,309 @@
 #define _CHAN_DETAIL_UNBUFFERED_CHANNEL
 
 #include <chrono>
+#include <cstddef>
 #include <expected>
+#include <iterator>
+#include <mutex>
+#include <utility>
 
 #include "../RecvError.hpp"
 #include "../SendError.hpp"
+#include "../SendRangeResult.hpp"
 #include "../TryRecvError.hpp"
 #include "../TrySendError.hpp"
+#include "Handoff.hpp"
 
 namespace chan::detail {
-template <typename Self, typename T> struct UnbufferedChannel {
+/// Unbuffered channel operations for a `Chan` that pairs senders and
+/// receivers through the `HandoffList`s `send_handoffs` and `recv_handoffs`.
+///
+/// `packet_mutex` only guards the lists and the `send_done` and `recv_done`
+/// flags, and is never held while waiting. A thread that finds no partner
+/// links a `Handoff` on its stack into its side's list and waits on the
+/// `Handoff` itself. The partner unlinks it under the mutex, then moves the
+/// item and wakes the waiter after releasing the mutex, so a handoff wakes one
+/// thread at most and the waiter does not touch the mutex again.
+///
+/// Linking a `Handoff` wakes the `Select` calls and suspended coroutines
+/// waiting on the other side, since it is what lets their `try_send` or
+/// `try_recv` succeed.
+template <typename Self, typename T, typename W> struct UnbufferedChannel {
   std::expected<void, SendError<T>> send(T item) {
     std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
-    if (static_cast<Self *>(this)->has_recv_packet()) {
-      static_cast<Self *>(this)->set_recv_packet(std::move(item));
-      lock.unlock();
-      static_cast<Self *>(this)->recv_ready.notify_all();
-    } else {
-      std::optional<T> packet(std::move(item));
-      static_cast<Self *>(this)->register_send_packet(&packet);
-      static_cast<Self *>(this)->send_ready.wait(lock, [this, &packet] {
-        return !packet || static_cast<Self *>(this)->recv_done;
-      });
+    if (static_cast<Self *>(this)->recv_done) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    if (auto receiver = static_cast<Self *>(this)->recv_handoffs.pop_front()) {
       lock.unlock();
-      if (packet) {
-        return std::unexpected(SendError{std::move(*packet)});
-      }
+      receiver->item.emplace(std::move(item));
+      receiver->complete();
+      return {};
+    }
+    Handoff<T> handoff(std::move(item));
+    static_cast<Self *>(this)->send_handoffs.push_back(handoff);
+    static_cast<Self *>(this)->recv_wakers.wake_all();
+    lock.unlock();
+    handoff.template wait<W>();
+    if (handoff.item) {
+      return std::unexpected(SendError{std::move(*handoff.item)});
     }
     return {};
   }
 
   std::expected<void, TrySendError<T>> try_send(T item) {
-    {
-      std::lock_guard _lock(static_cast<Self *>(this)->packet_mutex);
-      if (static_cast<Self *>(this)->recv_done) {
-        return std::unexpected(
-            TrySendError{TrySendErrorKind::Disconnected, std::move(item)});
-      }
-      if (!static_cast<Self *>(this)->has_recv_packet()) {
-        return std::unexpected(
-            TrySendError{TrySendErrorKind::Full, std::move(item)});
-      }
-      static_cast<Self *>(this)->set_recv_packet(std::move(item));
+    std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
+    if (static_cast<Self *>(this)->recv_done) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Disconnected, std::move(item)});
     }
-    static_cast<Self *>(this)->recv_ready.notify_all();
+    auto receiver = static_cast<Self *>(this)->recv_handoffs.pop_front();
+    if (!receiver) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Full, std::move(item)});
+    }
+    lock.unlock();
+    receiver->item.emplace(std::move(item));
+    receiver->complete();
     return {};
   }
 
   template <typename Rep, typename Period>
   std::expected<void, TrySendError<T>>
   try_send_for(T item, const std::chrono::duration<Rep, Period> &timeout) {
-    return this->try_send_timeout_impl(
-        std::move(item), [&](auto &lock, const auto &stop) {
-          return static_cast<Self *>(this)->send_ready.wait_for(lock, timeout,
-                                                                stop);
-        });
+    return this->try_send_until(std::move(item),
+                                std::chrono::steady_clock::now() + timeout);
   }
 
   template <typename Clock, typename Duration>
   std::expected<void, TrySendError<T>>
   try_send_until(T item,
                  const std::chrono::time_point<Clock, Duration> &deadline) {
-    return this->try_send_timeout_impl(std::move(item), [&](auto &lock,
-                                                            const auto &stop) {
-      return static_cast<Self *>(this)->send_ready.wait_until(lock, deadline,
-                                                              stop);
-    });
+    std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
+    if (static_cast<Self *>(this)->recv_done) {
+      return std::unexpected(
+          TrySendError{TrySendErrorKind::Disconnected, std::move(item)});
+    }
+    if (auto receiver = static_cast<Self *>(this)->recv_handoffs.pop_front()) {
+      lock.unlock();
+      receiver->item.emplace(std::move(item));
+      receiver->complete();
+      return {};
+    }
+    Handoff<T> handoff(std::move(item));
+    static_cast<Self *>(this)->send_handoffs.push_back(handoff);
+    static_cast<Self *>(this)->recv_wakers.wake_all();
+    lock.unlock();
+    if (!handoff.template wait_until<W>(deadline)) {
+      lock.lock();
+      if (static_cast<Self *>(this)->send_handoffs.remove(handoff)) {
+        return std::unexpected(
+            TrySendError{TrySendErrorKind::Full, std::move(*handoff.item)});
+      }
+      lock.unlock();
+      handoff.template finish<W>();
+    }
+    if (handoff.item) {
+      return std::unexpected(TrySendError{TrySendErrorKind::Disconnected,
+                                          std::move(*handoff.item)});
+    }
+    return {};
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    std::size_t count = 0;
+    while (true) {
+      auto result = this->try_send_n(std::move(first), n - count);
+      first = std::move(result.next);
+      count += result.count;
+      if (result.disconnected || count == n) {
+        return {std::move(first), count, result.disconnected};
+      }
+      // No receiver is waiting, so block on the next item by itself.
+      auto sent = this->send(std::ranges::iter_move(first));
+      if (!sent) {
+        if constexpr (std::indirectly_writable<I, T>) {
+          *first = std::move(sent.error().item);
+        }
+        return {std::move(first), count, true};
+      }
+      ++first;
+      ++count;
+    }
+  }
+
+  template <typename I> SendRangeResult<I> try_send_n(I first, std::size_t n) {
+    std::size_t count = 0;
+    std::lock_guard _lock(static_cast<Self *>(this)->packet_mutex);
+    auto disconnected = static_cast<Self *>(this)->recv_done;
+    while (!disconnected && count != n) {
+      auto receiver = static_cast<Self *>(this)->recv_handoffs.pop_front();
+      if (!receiver) {
+        break;
+      }
+      receiver->item.emplace(std::ranges::iter_move(first));
+      receiver->complete();
+      ++first;
+      ++count;
+    }
+    return {std::move(first), count, disconnected};
   }
 
   std::expected<T, RecvError> recv() {
     std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
-    if (static_cast<Self *>(this)->has_send_packet()) {
-      auto item = static_cast<Self *>(this)->take_send_packet();
+    if (auto sender = static_cast<Self *>(this)->send_handoffs.pop_front()) {
       lock.unlock();
-      static_cast<Self *>(this)->send_ready.notify_all();
-      return item;
-    } else {
-      std::optional<T> packet;
-      static_cast<Self *>(this)->register_recv_packet(&packet);
-      static_cast<Self *>(this)->recv_ready.wait(lock, [this, &packet] {
-        return packet || static_cast<Self *>(this)->send_done;
-      });
-      lock.unlock();
-      if (!packet) {
-        return std::unexpected(RecvError{});
-      }
-      return std::move(*packet);
+      return take(*sender);
+    }
+    if (static_cast<Self *>(this)->send_done) {
+      return std::unexpected(RecvError{});
+    }
+    Handoff<T> handoff;
+    static_cast<Self *>(this)->recv_handoffs.push_back(handoff);
+    static_cast<Self *>(this)->send_wakers.wake_all();
+    lock.unlock();
+    handoff.template wait<W>();
+    if (!handoff.item) {
+      return std::unexpected(RecvError{});
     }
+    return std::move(*handoff.item);
   }
 
   std::expected<T, TryRecvError> try_recv() {
     std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
+    if (auto sender = static_cast<Self *>(this)->send_handoffs.pop_front()) {
+      lock.unlock();
+      return take(*sender);
+    }
     if (static_cast<Self *>(this)->send_done) {
       return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
     }
-    if (!static_cast<Self *>(this)->has_send_packet()) {
-      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
-    }
-    auto item = static_cast<Self *>(this)->take_send_packet();
-    lock.unlock();
-    static_cast<Self *>(this)->send_ready.notify_all();
-    return item;
+    return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
   }
 
   template <typename Rep, typename Period>
   std::expected<T, TryRecvError>
   try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
-    return this->try_recv_timeout_impl([&](auto &lock, const auto &stop) {
-      return static_cast<Self *>(this)->recv_ready.wait_for(lock, timeout,
-                                                            stop);
-    });
+    return this->try_recv_until(std::chrono::steady_clock::now() + timeout);
   }
 
   template <typename Clock, typename Duration>
   std::expected<T, TryRecvError>
   try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
-    return this->try_recv_timeout_impl([&](auto &lock, const auto &stop) {
-      return static_cast<Self *>(this)->recv_ready.wait_until(lock, deadline,
-                                                              stop);
-    });
-  }
-
-private:
-  template <typename F>
-  std::expected<void, TrySendError<T>> try_send_timeout_impl(T item,
-                                                             const F &wait) {
     std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
-    if (static_cast<Self *>(this)->has_recv_packet()) {
-      static_cast<Self *>(this)->set_recv_packet(std::move(item));
+    if (auto sender = static_cast<Self *>(this)->send_handoffs.pop_front()) {
       lock.unlock();
-      static_cast<Self *>(this)->recv_ready.notify_all();
-    } else {
-      std::optional<T> packet(std::move(item));
-      static_cast<Self *>(this)->register_send_packet(&packet);
-      if (!wait(lock, [this, &packet] {
-            return !packet || static_cast<Self *>(this)->recv_done;
-          })) {
-        static_cast<Self *>(this)->unregister_send_packet(&packet);
-        return std::unexpected(
-            TrySendError{TrySendErrorKind::Full, std::move(*packet)});
+      return take(*sender);
+    }
+    if (static_cast<Self *>(this)->send_done) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    Handoff<T> handoff;
+    static_cast<Self *>(this)->recv_handoffs.push_back(handoff);
+    static_cast<Self *>(this)->send_wakers.wake_all();
+    lock.unlock();
+    if (!handoff.template wait_until<W>(deadline)) {
+      lock.lock();
+      if (static_cast<Self *>(this)->recv_handoffs.remove(handoff)) {
+        return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
       }
       lock.unlock();
-      if (packet) {
-        return std::unexpected(
-            TrySendError{TrySendErrorKind::Disconnected, std::move(*packet)});
+      handoff.template finish<W>();
+    }
+    if (!handoff.item) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    return std::move(*handoff.item);
+  }
+
+  template <typename O>
+  std::expected<std::size_t, RecvError> recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    auto result = this->try_recv_n_impl(out, n);
+    if (result) {
+      return *result;
+    }
+    if (result.error().is_disconnected()) {
+      return std::unexpected(RecvError{});
+    }
+    // No sender is waiting, so block on the first item by itself and then
+    // take whatever else is waiting.
+    auto item = this->recv();
+    if (!item) {
+      return std::unexpected(RecvError{});
+    }
+    *out = std::move(*item);
+    ++out;
+    return 1 + this->try_recv_n_impl(out, n - 1).value_or(0);
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n(O out, std::size_t n) {
+    if (n == 0) {
+      return 0;
+    }
+    return this->try_recv_n_impl(out, n);
+  }
+
+private:
+  /// Take the item from an unlinked sender's `Handoff` and wake the sender.
+  static T take(Handoff<T> &sender) {
+    auto item = std::move(*sender.item);
+    sender.item.reset();
+    sender.complete();
+    return item;
+  }
+
+  template <typename O>
+  std::expected<std::size_t, TryRecvError> try_recv_n_impl(O &out,
+                                                           std::size_t n) {
+    std::size_t received = 0;
+    std::lock_guard _lock(static_cast<Self *>(this)->packet_mutex);
+    while (received != n) {
+      auto sender = static_cast<Self *>(this)->send_handoffs.pop_front();
+      if (!sender) {
+        break;
       }
+      *out = take(*sender);
+      ++out;
+      ++received;
     }
-    return {};
+    if (received != 0) {
+      return received;
+    }
+    if (static_cast<Self *>(this)->send_done) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
   }
 
-  template <typename F>
-  std::expected<T, TryRecvError> try_recv_timeout_impl(const F &wait) {
-    std::unique_lock lock(static_cast<Self *>(this)->packet_mutex);
-    if (static_cast<Self *>(this)->has_send_packet()) {
-      auto item = static_cast<Self *>(this)->take_send_packet();
-      lock.unlock();
-      static_cast<Self *>(this)->send_ready.notify_all();
-      return item;
-    } else {
-      std::optional<T> packet;
-      static_cast<Self *>(this)->register_recv_packet(&packet);
-      if (!wait(lock, [this, &packet] {
-            return packet || static_cast<Self *>(this)->send_done;
-          })) {
-        static_cast<Self *>(this)->unregister_recv_packet(&packet);
-        return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+protected:
+  /// Fail every waiting receiver once the last `Sender` is gone.
+  void close_send_side() {
+    {
+      std::lock_guard _lock(static_cast<Self *>(this)->packet_mutex);
+      static_cast<Self *>(this)->send_done = true;
+      while (auto receiver =
+                 static_cast<Self *>(this)->recv_handoffs.pop_front()) {
+        receiver->complete();
       }
-      lock.unlock();
-      if (!packet) {
-        return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    static_cast<Self *>(this)->recv_wakers.wake_all();
+  }
+
+  /// Fail every waiting sender once the last `Receiver` is gone.
+  void close_recv_side() {
+    {
+      std::lock_guard _lock(static_cast<Self *>(this)->packet_mutex);
+      static_cast<Self *>(this)->recv_done = true;
+      while (auto sender =
+                 static_cast<Self *>(this)->send_handoffs.pop_front()) {
+        sender->complete();
       }
-      return std::move(*packet);
     }
+    static_cast<Self *>(this)->send_wakers.wake_all();
   }
 };
 } // namespace chan::detail
@@ -0,0 +1,95 @@
+#ifndef _CHAN_DETAIL_WAKE_ALL_EVENT_H
+#define _CHAN_DETAIL_WAKE_ALL_EVENT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "ThreadWaker.hpp"
+#include "WakerList.hpp"
+
+namespace chan::detail {
+/// Like `EventCount`, but every notification wakes every sleeping thread.
+///
+/// Use this when waiters check different conditions, such as receivers that
+/// each wait for a value they have not seen yet. With an `EventCount`, a woken
+/// thread whose condition is still false could take the permit meant for
+/// another one and leave it asleep. Here, a thread that has to sleep adds a
+/// `ThreadWaker` of its own to the same list as `Select` calls and suspended
+/// coroutines.
+///
+/// Before sleeping, a waiter polls its condition for as long as the wait
+/// strategy `W` allows.
+template <typename W> class WakeAllEvent {
+  WakerList waker_list;
+
+public:
+  /// Block until `ready()` returns `true`.
+  ///
+  /// `ready` may have side effects. It is not called again after it returns
+  /// `true`.
+  template <typename F> void wait(const F &ready) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (W::pause(iteration)) {
+        continue;
+      }
+      ThreadWaker waker;
+      this->waker_list.add(waker);
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+      while (!ready()) {
+        waker.wait();
+      }
+      this->waker_list.remove(waker);
+      return;
+    }
+  }
+
+  /// Block until `ready()` returns `true` or the timeout is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Rep, typename Period>
+  bool wait_for(const F &ready,
+                const std::chrono::duration<Rep, Period> &timeout) {
+    return this->wait_until(ready, std::chrono::steady_clock::now() + timeout);
+  }
+
+  /// Block until `ready()` returns `true` or the deadline is met.
+  ///
+  /// Returns the last result of `ready()`.
+  template <typename F, typename Clock, typename Duration>
+  bool wait_until(const F &ready,
+                  const std::chrono::time_point<Clock, Duration> &deadline) {
+    for (std::size_t iteration = 0; !ready(); ++iteration) {
+      if (W::pause(iteration)) {
+        if (Clock::now() >= deadline) {
+          return ready();
+        }
+        continue;
+      }
+      ThreadWaker waker;
+      this->waker_list.add(waker);
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+      auto done = ready();
+      while (!done && waker.wait_until(deadline)) {
+        done = ready();
+      }
+      this->waker_list.remove(waker);
+      return done || ready();
+    }
+    return true;
+  }
+
+  /// Wake all sleeping threads.
+  ///
+  /// Call after changing the state that waiters are checking.
+  void notify_all() {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    this->waker_list.wake_all();
+  }
+
+  /// Wakers waiting for a notification, including sleeping threads.
+  WakerList &wakers() { return this->waker_list; }
+};
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef _CHAN_DETAIL_WAKER_H
+#define _CHAN_DETAIL_WAKER_H
+
+namespace chan::detail {
+/// Something waiting on a channel through a `WakerList`, such as a `Select` or
+/// a suspended coroutine.
+///
+/// `wake` is called with the `WakerList`'s mutex held, so it must not block or
+/// touch the channel.
+class Waker {
+public:
+  virtual void wake() = 0;
+
+protected:
+  ~Waker() = default;
+};
+} // namespace chan::detail
+
+#endif
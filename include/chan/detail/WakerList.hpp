@@ -0,0 +1,56 @@
+#ifndef _CHAN_DETAIL_WAKER_LIST_H
+#define _CHAN_DETAIL_WAKER_LIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Waker.hpp"
+
+namespace chan::detail {
+/// Wakers of the `Select` calls and suspended coroutines waiting on one side of
+/// a channel.
+///
+/// A waiter adds its waker, issues a sequentially consistent fence and then
+/// re-checks its operations before going to sleep. The channel calls
+/// `wake_all` after changing the state those operations depend on, following
+/// a sequentially consistent fence or a release of the mutex that guards that
+/// state. Either the waiter sees the new state or `wake_all` sees its waker.
+///
+/// While nothing is waiting, `wake_all` is a single relaxed load.
+class WakerList {
+  std::atomic_size_t count;
+  std::mutex mutex;
+  std::vector<Waker *> wakers;
+
+public:
+  WakerList() : count(0) {}
+
+  void add(Waker &waker) {
+    std::lock_guard _lock(this->mutex);
+    this->wakers.push_back(&waker);
+    this->count.fetch_add(1, std::memory_order::relaxed);
+  }
+
+  /// Remove one occurrence of `waker`. It is not woken after this returns.
+  void remove(Waker &waker) {
+    std::lock_guard _lock(this->mutex);
+    this->wakers.erase(std::ranges::find(this->wakers, &waker));
+    this->count.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+  void wake_all() {
+    if (this->count.load(std::memory_order::relaxed) == 0) {
+      return;
+    }
+    std::lock_guard _lock(this->mutex);
+    for (auto waker : this->wakers) {
+      waker->wake();
+    }
+  }
+};
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef _CHAN_DETAIL_BACKOFF_H
+#define _CHAN_DETAIL_BACKOFF_H
+
+#include <cstddef>
+#include <thread>
+
+namespace chan::detail {
+/// Wait for another thread to finish a step that it has already started, such
+/// as filling a claimed slot.
+///
+/// There is nothing to be notified by, so strategies that would sleep yield
+/// instead.
+template <typename W> void backoff(std::size_t iteration) {
+  if (!W::pause(iteration)) {
+    std::this_thread::yield();
+  }
+}
+} // namespace chan::detail
+
+#endif
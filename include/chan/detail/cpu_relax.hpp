@@ -0,0 +1,24 @@
+#ifndef _CHAN_DETAIL_CPU_RELAX_H
+#define _CHAN_DETAIL_CPU_RELAX_H
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace chan::detail {
+/// Tell the CPU that the current thread is in a spin loop.
+///
+/// Lowers the cost of spinning for a hyperthread sibling and avoids the memory
+/// order mis-speculation penalty when the loop exits.
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield");
+#endif
+}
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef _CHAN_DETAIL_EMPLACE_WITH_H
+#define _CHAN_DETAIL_EMPLACE_WITH_H
+
+#include <expected>
+#include <utility>
+
+namespace chan::detail {
+/// Send an item constructed from `args` through a slot from `reserve()`,
+/// which returns a `std::expected` of a `SendSlot`.
+///
+/// The item is constructed directly in the slot. If its constructor throws,
+/// the slot is abandoned when it is destroyed, and nothing is sent.
+template <typename F, typename... Args>
+auto emplace_with(const F &reserve, Args &&...args)
+    -> std::expected<void, typename decltype(reserve())::error_type> {
+  auto slot = reserve();
+  if (!slot) {
+    return std::unexpected(std::move(slot.error()));
+  }
+  slot->emplace(std::forward<Args>(args)...);
+  return {};
+}
+} // namespace chan::detail
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _CHAN_DETAIL_SEND_RANGE_WITH_H
+#define _CHAN_DETAIL_SEND_RANGE_WITH_H
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+#include "../SendRangeResult.hpp"
+
+namespace chan::detail {
+/// Send every item in `items` through `send_n(first, n)`, which sends up to
+/// `n` items starting at `first`.
+///
+/// When the number of items can be known up front, the whole range is handed
+/// to `send_n` at once so the channel can reserve slots in bulk. Single-pass
+/// ranges of unknown length are sent one item at a time.
+template <typename R, typename F>
+SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+send_range_with(R &&items, const F &send_n) {
+  if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+    auto count = static_cast<std::size_t>(std::ranges::distance(items));
+    auto result = send_n(std::ranges::begin(items), count);
+    return {std::move(result.next), result.count, result.disconnected};
+  } else {
+    SendRangeResult<std::ranges::iterator_t<R>> result{
+        std::ranges::begin(items), 0, false};
+    auto last = std::ranges::end(items);
+    while (result.next != last) {
+      auto one = send_n(std::move(result.next), 1);
+      result.next = std::move(one.next);
+      result.count += one.count;
+      if (one.disconnected) {
+        result.disconnected = true;
+        break;
+      }
+    }
+    return {std::move(result.next), result.count, result.disconnected};
+  }
+}
+} // namespace chan::detail
+
+#endif
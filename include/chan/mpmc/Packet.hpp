@@ -3,13 +3,15 @@
 
 #include <atomic>
 
+#include "../detail/CACHE_LINE_SIZE.hpp"
+
 namespace chan::mpmc {
 /// Item with synchronization flags.
 ///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
 template <typename T> struct Packet {
-  T item;
+  alignas(detail::PACKET_ALIGNMENT) alignas(T) T item;
   std::atomic_bool read_ready;
   std::atomic_bool write_ready;
 };
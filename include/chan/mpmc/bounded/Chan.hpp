@@ -1,35 +1,42 @@
 #ifndef _CHAN_MPMC_BOUNDED_CHANNEL_H
 #define _CHAN_MPMC_BOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <memory>
 #include <optional>
-#include <thread>
 
-#include "../../detail/BoundedChannel.hpp"
-#include "../../detail/SemaphoreType.hpp"
-#include "../Packet.hpp"
+#include "../../detail/BoundedRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+#include "Packet.hpp"
 
 namespace chan::mpmc::bounded {
 /// Channel implementation.
 ///
+/// `head_index` and `tail_index` are positions that only ever increase. Each
+/// packet's sequence number tells whether it is ready for the sender or
+/// receiver that claims its position, so a claim is a single compare-exchange
+/// and the event counts are only used when a side has to sleep.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, typename A>
-class Chan : detail::BoundedChannel<Chan<T, A>, T> {
-  friend struct detail::BoundedChannel<Chan, T>;
-  template <typename, typename, typename> friend class Sender;
-  template <typename, typename, typename> friend class Receiver;
+template <typename T, typename W, typename A>
+class Chan : detail::BoundedRingChannel<Chan<T, W, A>, T> {
+  friend struct detail::BoundedRingChannel<Chan, T>;
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
 
   A allocator;
   std::allocator_traits<A>::pointer packet_buffer;
   std::size_t capacity;
-  std::atomic_size_t head_index;
-  std::atomic_size_t tail_index;
-  std::atomic_size_t size;
-  detail::SemaphoreType send_ready;
-  detail::SemaphoreType recv_ready;
-  std::atomic_size_t sender_count;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
   std::atomic_size_t receiver_count;
   std::atomic_bool disconnected;
 
@@ -42,14 +49,11 @@ public:
       : allocator(std::move(allocator)),
         packet_buffer(
             std::allocator_traits<A>::allocate(this->allocator, capacity)),
-        capacity(capacity), head_index(0), tail_index(0), size(0),
-        send_ready(capacity), recv_ready(0), sender_count(1), receiver_count(1),
-        disconnected(false) {
+        capacity(capacity), head_index(0), tail_index(0), sender_count(1),
+        receiver_count(1), disconnected(false) {
     for (std::size_t index = 0; index < capacity; ++index) {
       std::allocator_traits<A>::construct(
-          this->allocator, &this->packet_buffer[index].read_ready, false);
-      std::allocator_traits<A>::construct(
-          this->allocator, &this->packet_buffer[index].write_ready, true);
+          this->allocator, &this->packet_buffer[index].sequence, 2 * index);
     }
   }
 
@@ -57,18 +61,14 @@ public:
     auto index = this->head_index.load(std::memory_order::relaxed);
     auto tail_index = this->tail_index.load(std::memory_order::relaxed);
     while (index != tail_index) {
-      std::allocator_traits<A>::destroy(this->allocator,
-                                        &this->packet_buffer[index].item);
-      if (++index == this->capacity) {
-        index = 0;
-      }
+      std::allocator_traits<A>::destroy(
+          this->allocator, &this->packet_buffer[index % this->capacity].item);
+      ++index;
     }
 
     for (std::size_t index = 0; index < this->capacity; ++index) {
       std::allocator_traits<A>::destroy(this->allocator,
-                                        &this->packet_buffer[index].read_ready);
-      std::allocator_traits<A>::destroy(
-          this->allocator, &this->packet_buffer[index].write_ready);
+                                        &this->packet_buffer[index].sequence);
     }
 
     std::allocator_traits<A>::deallocate(this->allocator, this->packet_buffer,
@@ -76,39 +76,152 @@ public:
   }
 
 private:
-  void do_send(T item) {
-    std::size_t tail_index;
-    do {
-      tail_index = this->tail_index.load(std::memory_order::relaxed);
-    } while (!this->tail_index.compare_exchange_weak(
-        tail_index, tail_index == this->capacity - 1 ? 0 : tail_index + 1,
-        std::memory_order::relaxed));
-
-    auto &packet = this->packet_buffer[tail_index];
-    while (!packet.write_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+  bool try_do_send(T &item) {
+    if (this->capacity == 0) {
+      return false;
+    }
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    while (true) {
+      auto &packet = this->packet_buffer[tail_index % this->capacity];
+      auto sequence = packet.sequence.load(std::memory_order::acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - 2 * tail_index);
+      if (lag == 0) {
+        if (this->tail_index.compare_exchange_weak(
+                tail_index, tail_index + 1, std::memory_order::relaxed)) {
+          std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                              std::move(item));
+          packet.sequence.store(2 * tail_index + 1, std::memory_order::release);
+          return true;
+        }
+      } else if (lag < 0) {
+        // The packet still holds the item from the previous lap.
+        return false;
+      } else {
+        tail_index = this->tail_index.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  template <typename I> std::size_t try_do_send_n(I &first, std::size_t n) {
+    if (this->capacity == 0) {
+      return 0;
+    }
+    n = std::min(n, this->capacity);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    while (true) {
+      // Count the free packets in a row starting at the tail. Only the sender
+      // that moves the tail past a free packet can fill it, so they stay free
+      // if the compare-exchange succeeds.
+      std::size_t claimed = 0;
+      std::ptrdiff_t lag = 0;
+      while (claimed < n) {
+        auto index = tail_index + claimed;
+        auto sequence = this->packet_buffer[index % this->capacity]
+                            .sequence.load(std::memory_order::acquire);
+        lag = static_cast<std::ptrdiff_t>(sequence - 2 * index);
+        if (lag != 0) {
+          break;
+        }
+        ++claimed;
+      }
+      if (claimed == 0) {
+        if (lag < 0) {
+          return 0;
+        }
+        tail_index = this->tail_index.load(std::memory_order::relaxed);
+        continue;
+      }
+      if (this->tail_index.compare_exchange_weak(tail_index,
+                                                 tail_index + claimed,
+                                                 std::memory_order::relaxed)) {
+        for (std::size_t offset = 0; offset < claimed; ++offset, ++first) {
+          auto index = tail_index + offset;
+          auto &packet = this->packet_buffer[index % this->capacity];
+          std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                              std::ranges::iter_move(first));
+          packet.sequence.store(2 * index + 1, std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  std::optional<T> try_do_recv() {
+    if (this->capacity == 0) {
+      return {};
+    }
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    while (true) {
+      auto &packet = this->packet_buffer[head_index % this->capacity];
+      auto sequence = packet.sequence.load(std::memory_order::acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - (2 * head_index + 1));
+      if (lag == 0) {
+        if (this->head_index.compare_exchange_weak(
+                head_index, head_index + 1, std::memory_order::relaxed)) {
+          std::optional<T> item(std::move(packet.item));
+          std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+          packet.sequence.store(2 * (head_index + this->capacity),
+                                std::memory_order::release);
+          return item;
+        }
+      } else if (lag < 0) {
+        // No sender has filled the packet for this position yet.
+        return {};
+      } else {
+        head_index = this->head_index.load(std::memory_order::relaxed);
+      }
     }
-    std::allocator_traits<A>::construct(this->allocator, &packet.item,
-                                        std::move(item));
-    packet.read_ready.store(true, std::memory_order::release);
   }
 
-  T do_recv() {
-    std::size_t head_index;
-    do {
-      head_index = this->head_index.load(std::memory_order::relaxed);
-    } while (!this->head_index.compare_exchange_weak(
-        head_index, head_index == this->capacity - 1 ? 0 : head_index + 1,
-        std::memory_order::relaxed));
-
-    auto &packet = this->packet_buffer[head_index];
-    while (!packet.read_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    if (this->capacity == 0) {
+      return 0;
     }
-    auto item = std::move(packet.item);
-    std::allocator_traits<A>::destroy(this->allocator, &packet.item);
-    packet.write_ready.store(true, std::memory_order::release);
-    return item;
+    n = std::min(n, this->capacity);
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    while (true) {
+      // Count the filled packets in a row starting at the head. Only the
+      // receiver that moves the head past a filled packet can empty it.
+      std::size_t claimed = 0;
+      std::ptrdiff_t lag = 0;
+      while (claimed < n) {
+        auto index = head_index + claimed;
+        auto sequence = this->packet_buffer[index % this->capacity]
+                            .sequence.load(std::memory_order::acquire);
+        lag = static_cast<std::ptrdiff_t>(sequence - (2 * index + 1));
+        if (lag != 0) {
+          break;
+        }
+        ++claimed;
+      }
+      if (claimed == 0) {
+        if (lag < 0) {
+          return 0;
+        }
+        head_index = this->head_index.load(std::memory_order::relaxed);
+        continue;
+      }
+      if (this->head_index.compare_exchange_weak(head_index,
+                                                 head_index + claimed,
+                                                 std::memory_order::relaxed)) {
+        for (std::size_t offset = 0; offset < claimed; ++offset, ++out) {
+          auto index = head_index + offset;
+          auto &packet = this->packet_buffer[index % this->capacity];
+          *out = std::move(packet.item);
+          std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+          packet.sequence.store(2 * (index + this->capacity),
+                                std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
   }
 
   bool send_done() const {
@@ -131,8 +244,7 @@ private:
     if (this->sender_count.fetch_sub(1, std::memory_order::acq_rel) != 1) {
       return false;
     }
-    auto receiver_count = this->receiver_count.load(std::memory_order::relaxed);
-    this->recv_ready.release(receiver_count);
+    this->recv_ready.notify_all();
     return this->disconnected.exchange(true, std::memory_order::acq_rel);
   }
 
@@ -140,8 +252,7 @@ private:
     if (this->receiver_count.fetch_sub(1, std::memory_order::acq_rel) != 1) {
       return false;
     }
-    auto sender_count = this->sender_count.load(std::memory_order::relaxed);
-    this->send_ready.release(sender_count);
+    this->send_ready.notify_all();
     return this->disconnected.exchange(true, std::memory_order::acq_rel);
   }
 };
@@ -0,0 +1,25 @@
+#ifndef _CHAN_MPMC_BOUNDED_PACKET_H
+#define _CHAN_MPMC_BOUNDED_PACKET_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+
+namespace chan::mpmc::bounded {
+/// Item with a sequence number.
+///
+/// A packet is free for the sender that claims position `p` when
+/// `sequence == 2 * p`, and holds an item for the receiver that claims position
+/// `p` when `sequence == 2 * p + 1`. Doubling keeps the two states distinct
+/// even when the capacity is 1.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T> struct Packet {
+  alignas(detail::PACKET_ALIGNMENT) alignas(T) T item;
+  std::atomic_size_t sequence;
+};
+} // namespace chan::mpmc::bounded
+
+#endif
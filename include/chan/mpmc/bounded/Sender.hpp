@@ -2,9 +2,19 @@
 #define _CHAN_MPMC_BOUNDED_SENDER_H
 
 #include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <ranges>
+#include <utility>
 
+#include "../../Select.hpp"
 #include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 
 namespace chan::mpmc::bounded {
@@ -12,15 +22,19 @@ namespace chan::mpmc::bounded {
 ///
 /// # Template parameters
 /// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Allocator for the channel's item buffer
 /// `A2` (optional) - Allocator for the channel object
 ///
 /// # Safety
 /// Do not share a `Sender` between threads. If multiple threads need to
 /// send to the same channel, give each thread a its own `Sender` copy.
-template <typename T, typename A1 = std::allocator<Packet<T>>,
-          typename A2 = std::allocator<Chan<T, A1>>>
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<Packet<T>>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
 class Sender {
+  friend class chan::Select;
+
 public:
   using Item = T;
 
@@ -89,9 +103,6 @@ public:
 
   /// Send an item on the channel without blocking.
   ///
-  /// Because semaphore try_acquire operations may spuriously fail, this
-  /// function may spuriously fail with `TrySendErrorKind::Full`.
-  ///
   /// # Safety
   /// Causes undefined behavior if `is_null()` is `true`.
   std::expected<void, TrySendError<T>> try_send(T item) const {
@@ -128,6 +139,78 @@ public:
     return this->channel->try_send_until(std::move(item), deadline);
   }
 
+  /// Send an item on the channel in a coroutine.
+  ///
+  /// `co_await tx.async_send(item, executor)` suspends the coroutine until the
+  /// channel is not full or all receivers disconnect, then returns what
+  /// `send(item)` would have returned. The coroutine is resumed by a function
+  /// object that is passed to `executor`, which must queue it to run on some
+  /// thread rather than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_send(T item, E executor) const {
+    assert(this->channel != nullptr);
+    return detail::send_awaiter(*this, this->wakers(), std::move(item),
+                                std::move(executor));
+  }
+
+  /// Send every item in a range on the channel.
+  ///
+  /// Items are moved out of the range. Blocks until every item is sent or all
+  /// receivers disconnect. Free slots are reserved for as many items as
+  /// possible at once, so a batch costs about as much synchronization as a
+  /// single item.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
+  /// Send up to `n` items, starting at `first`, on the channel without
+  /// blocking.
+  ///
+  /// Reserves as many free slots as are available, up to `n`, in one step and
+  /// sends that many items.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> try_send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_n(std::move(first), n);
+  }
+
   /// Number of items in the channel.
   ///
   /// Since the channel's size could change at any moment, it should not be used
@@ -137,7 +220,7 @@ public:
   /// Causes undefined behavior if `is_null()` is `true`.
   std::size_t channel_size() const {
     assert(this->channel != nullptr);
-    return this->channel->size.load(std::memory_order::relaxed);
+    return this->channel->size();
   }
 
   /// Number of items the channel has allocated space for.
@@ -174,6 +257,10 @@ private:
     }
   }
 
+  detail::WakerList &wakers() const {
+    return this->channel->send_ready.wakers();
+  }
+
 public:
   SendIter<Sender> begin() const { return SendIter(*this); }
 
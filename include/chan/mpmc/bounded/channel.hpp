@@ -1,6 +1,7 @@
 #ifndef _CHAN_MPMC_BOUNDED_CREATE_H
 #define _CHAN_MPMC_BOUNDED_CREATE_H
 
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 #include "Receiver.hpp"
 #include "Sender.hpp"
@@ -15,19 +16,21 @@ namespace chan::mpmc::bounded {
 ///
 /// # Template parameters
 /// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Type of `buffer_allocator` parameter
 /// `A2` (optional) - Type of `channel_allocator` parameter
-template <typename T, typename A1 = std::allocator<Packet<T>>,
-          typename A2 = std::allocator<Chan<T, A1>>>
-std::pair<Sender<T, A1, A2>, Receiver<T, A1, A2>>
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<Packet<T>>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+std::pair<Sender<T, W, A1, A2>, Receiver<T, W, A1, A2>>
 channel(std::size_t capacity, A1 buffer_allocator = A1(),
         A2 channel_allocator = A2()) {
   auto channel = std::allocator_traits<A2>::allocate(channel_allocator, 1);
   std::allocator_traits<A2>::construct(channel_allocator, channel, capacity,
                                        std::move(buffer_allocator));
-  Sender<T, A1, A2> sender(channel, channel_allocator);
-  Receiver<T, A1, A2> receiver(std::move(channel),
-                               std::move(channel_allocator));
+  Sender<T, W, A1, A2> sender(channel, channel_allocator);
+  Receiver<T, W, A1, A2> receiver(std::move(channel),
+                                  std::move(channel_allocator));
   return {std::move(sender), std::move(receiver)};
 }
 } // namespace chan::mpmc::bounded
@@ -0,0 +1,250 @@
+#ifndef _CHAN_MPMC_PRIORITY_RECEIVER_H
+#define _CHAN_MPMC_PRIORITY_RECEIVER_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+
+#include "../../RecvIter.hpp"
+#include "../../Select.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::mpmc::priority {
+/// Receiving half of a channel.
+///
+/// Items are received highest priority first, and in the order they were sent
+/// within a priority.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `LEVELS` - Number of priorities
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's item queues
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Receiver` between threads. If multiple threads need to
+/// receive from the same channel, give each thread a its own `Receiver` copy.
+template <typename T, std::size_t LEVELS, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, LEVELS, W, A1>>>
+class Receiver {
+  friend class chan::Select;
+
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Receiver(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : channel(nullptr), allocator() {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Receiver(const Receiver &other)
+      : channel(other.channel), allocator(other.allocator) {
+    this->acquire();
+  }
+
+  Receiver &operator=(const Receiver &other) {
+    this->release();
+    this->channel = other.channel;
+    this->allocator = other.allocator;
+    this->acquire();
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Receive the highest priority item from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->recv();
+  }
+
+  /// Receive the highest priority item from the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv();
+  }
+
+  /// Receive the highest priority item from the channel with a timeout.
+  ///
+  /// Blocks until the channel is not empty, the timeout is met, or all senders
+  /// disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_for(timeout);
+  }
+
+  /// Receive the highest priority item from the channel with a deadline.
+  ///
+  /// Blocks until the channel is not empty, the deadline is met, or all senders
+  /// disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_until(deadline);
+  }
+
+  /// Receive the highest priority item from the channel in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until the
+  /// channel is not empty or all senders disconnect, then returns what `recv()`
+  /// would have returned. The coroutine is resumed by a function object that is
+  /// passed to `executor`, which must queue it to run on some thread rather
+  /// than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Receive up to `items.size()` items from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect. Then
+  /// takes as many items as are available, up to `items.size()`, in a single
+  /// step, highest priority first.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, RecvError> recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->recv_n(items.begin(), items.size());
+  }
+
+  /// Receive up to `items.size()` items from the channel without blocking.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, TryRecvError>
+  try_recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(items.begin(), items.size());
+  }
+
+  /// Move up to `limit` items from the channel to `out` without blocking.
+  ///
+  /// Returns the number of items received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::weakly_incrementable O>
+    requires std::indirectly_writable<O, T>
+  std::expected<std::size_t, TryRecvError>
+  drain_into(O out, std::size_t limit =
+                        std::numeric_limits<std::size_t>::max()) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(std::move(out), limit);
+  }
+
+  /// Number of items in the channel, across all priorities.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a receive operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire() {
+    if (this->channel) {
+      this->channel->acquire_receiver();
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_receiver()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+  detail::WakerList &wakers() const {
+    return this->channel->recv_ready.wakers();
+  }
+
+public:
+  RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::mpmc::priority
+
+#endif
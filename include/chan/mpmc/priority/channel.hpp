@@ -0,0 +1,41 @@
+#ifndef _CHAN_MPMC_PRIORITY_CREATE_H
+#define _CHAN_MPMC_PRIORITY_CREATE_H
+
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::mpmc::priority {
+/// Create a new channel and get a `Sender` and `Receiver` for it.
+///
+/// Sending never blocks. Receiving always takes the oldest item of the
+/// highest priority that has any.
+///
+/// # Parameters
+/// `queue_allocator` (optional) - Allocator for the channel's item queues
+/// `channel_allocator` (optional) - Allocator for the channel object
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `LEVELS` - Number of priorities, which must not be 0
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Type of `queue_allocator` parameter
+/// `A2` (optional) - Type of `channel_allocator` parameter
+template <typename T, std::size_t LEVELS, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, LEVELS, W, A1>>>
+  requires(LEVELS != 0)
+std::pair<Sender<T, LEVELS, W, A1, A2>, Receiver<T, LEVELS, W, A1, A2>>
+channel(A1 queue_allocator = A1(), A2 channel_allocator = A2()) {
+  auto channel = std::allocator_traits<A2>::allocate(channel_allocator, 1);
+  std::allocator_traits<A2>::construct(channel_allocator, channel,
+                                       std::move(queue_allocator));
+  Sender<T, LEVELS, W, A1, A2> sender(channel, channel_allocator);
+  Receiver<T, LEVELS, W, A1, A2> receiver(std::move(channel),
+                                          std::move(channel_allocator));
+  return {std::move(sender), std::move(receiver)};
+}
+} // namespace chan::mpmc::priority
+
+#endif
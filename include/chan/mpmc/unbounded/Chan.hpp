@@ -1,46 +1,80 @@
 #ifndef _CHAN_MPMC_UNBOUNDED_CHANNEL_H
 #define _CHAN_MPMC_UNBOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <expected>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <thread>
 
+#include "../../DEFAULT_MAX_CHUNKS_PER_ALLOCATION.hpp"
 #include "../../SendError.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/Semaphore.hpp"
 #include "../../detail/UnboundedChannel.hpp"
+#include "../../detail/backoff.hpp"
 #include "PacketChunk.hpp"
 
 namespace chan::mpmc::unbounded {
 /// Channel implementation.
 ///
+/// Receivers claim packets by advancing `head_position` with a
+/// compare-exchange, so they never take a lock, and never past `tail_count`,
+/// the number of packets claimed by senders. A receiver still waits for the
+/// sender to fill each packet it claims. A position is split into a chunk lap
+/// and an index within the chunk, with one extra index per lap, `CHUNK_SIZE`,
+/// meaning the receiver that claimed the last packet of the head chunk is
+/// moving the head to the next chunk. Other receivers back off until it is
+/// done. Claimed packets count towards `size` until they are emptied, so their
+/// chunk is not reused in the meantime.
+///
+/// When the ring is full, a batch of chunks as large as the ring, up to
+/// `max_batch_size`, is allocated. A batch is deallocated once all of its
+/// chunks have been freed. When a sender moves the tail to a new chunk, idle
+/// chunks beyond `idle_chunk_limit` are freed. A chunk behind the head is only
+/// idle once every packet in it has been emptied, and only while
+/// `filled_count` shows that no other sender is still filling a packet it
+/// claimed, since such a packet looks the same as an emptied one.
+/// `tail_position_mutex` also serializes changes to the ring with
+/// `shrink_to_fit`.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, std::size_t CHUNK_SIZE, typename A>
+template <typename T, std::size_t CHUNK_SIZE, typename W, typename A>
   requires(CHUNK_SIZE != 0)
-class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, A>, T> {
+class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, W, A>, T> {
   friend struct detail::UnboundedChannel<Chan, T>;
-  template <typename, std::size_t, typename, typename> friend class Sender;
-  template <typename, std::size_t, typename, typename> friend class Receiver;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Sender;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Receiver;
+
+  static constexpr std::size_t LAP = CHUNK_SIZE + 1;
 
   A allocator;
 
-  PacketChunk<T, CHUNK_SIZE> *tail_chunk;
+  alignas(detail::CACHE_LINE_SIZE) PacketChunk<T, CHUNK_SIZE> *tail_chunk;
   std::size_t tail_index;
+  std::atomic_size_t tail_count;
+  std::atomic_size_t filled_count;
   std::mutex tail_position_mutex;
 
-  PacketChunk<T, CHUNK_SIZE> *head_chunk;
-  std::size_t head_index;
-  std::mutex head_position_mutex;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_position;
+  std::atomic<PacketChunk<T, CHUNK_SIZE> *> head_chunk;
 
-  std::atomic_size_t size;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t size;
   std::atomic_size_t capacity;
+  std::atomic_size_t idle_chunk_limit;
+  std::atomic_size_t max_batch_size;
 
-  detail::SemaphoreType recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> recv_ready;
 
-  std::atomic_size_t sender_count;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
   std::atomic_size_t receiver_count;
   std::atomic_bool disconnected;
 
@@ -52,21 +86,21 @@ public:
   Chan(A allocator)
       : allocator(std::move(allocator)),
         tail_chunk(std::allocator_traits<A>::allocate(this->allocator, 1)),
-        tail_index(0), head_chunk(this->tail_chunk), head_index(0), size(0),
-        capacity(CHUNK_SIZE), recv_ready(0), sender_count(1), receiver_count(1),
-        disconnected(false) {
-    for (auto &packet : this->tail_chunk->packets) {
-      std::allocator_traits<A>::construct(this->allocator, &packet.read_ready,
-                                          false);
-      std::allocator_traits<A>::construct(this->allocator, &packet.write_ready,
-                                          true);
-    }
+        tail_index(0), tail_count(0), filled_count(0), head_position(0),
+        head_chunk(this->tail_chunk), size(0), capacity(CHUNK_SIZE),
+        idle_chunk_limit(std::numeric_limits<std::size_t>::max()),
+        max_batch_size(DEFAULT_MAX_CHUNKS_PER_ALLOCATION), recv_ready(0),
+        sender_count(1), receiver_count(1), disconnected(false) {
+    this->construct_flags(this->tail_chunk);
     this->tail_chunk->next = this->tail_chunk;
+    this->tail_chunk->batch = this->tail_chunk;
+    this->tail_chunk->batch_size = 1;
+    this->tail_chunk->freed_count = 0;
   }
 
   ~Chan() {
-    auto chunk = this->head_chunk;
-    auto index = this->head_index;
+    auto chunk = this->head_chunk.load(std::memory_order::relaxed);
+    auto index = this->head_position.load(std::memory_order::relaxed) % LAP;
     while (chunk != this->tail_chunk || index != this->tail_index) {
       std::allocator_traits<A>::destroy(this->allocator,
                                         &chunk->packets[index].item);
@@ -77,18 +111,10 @@ public:
     }
 
     auto c = chunk->next;
-    for (auto &packet : chunk->packets) {
-      std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
-      std::allocator_traits<A>::destroy(this->allocator, &packet.write_ready);
-    }
-    std::allocator_traits<A>::deallocate(this->allocator, chunk, 1);
+    this->free_chunk(chunk);
     while (c != chunk) {
       auto next = c->next;
-      for (auto &packet : c->packets) {
-        std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
-        std::allocator_traits<A>::destroy(this->allocator, &packet.write_ready);
-      }
-      std::allocator_traits<A>::deallocate(this->allocator, c, 1);
+      this->free_chunk(c);
       c = next;
     }
   }
@@ -103,65 +129,262 @@ private:
       std::lock_guard _lock(this->tail_position_mutex);
       auto size = this->size.fetch_add(1, std::memory_order::acquire);
       packet = &this->tail_chunk->packets[this->tail_index];
-      if (this->tail_index != CHUNK_SIZE - 1) {
-        ++this->tail_index;
-      } else {
-        this->tail_index = 0;
-        if (size <
-            this->capacity.load(std::memory_order::relaxed) - CHUNK_SIZE) {
-          this->tail_chunk = this->tail_chunk->next;
-        } else {
-          auto new_chunk =
-              std::allocator_traits<A>::allocate(this->allocator, 1);
-          for (auto &packet : new_chunk->packets) {
-            std::allocator_traits<A>::construct(this->allocator,
-                                                &packet.read_ready, false);
-            std::allocator_traits<A>::construct(this->allocator,
-                                                &packet.write_ready, true);
-          }
-          new_chunk->next = this->tail_chunk->next;
-          this->tail_chunk->next = new_chunk;
-          this->tail_chunk = new_chunk;
-          this->capacity.fetch_add(CHUNK_SIZE, std::memory_order::relaxed);
-        }
-      }
+      this->advance_tail(size);
+      this->tail_count.fetch_add(1, std::memory_order::release);
     }
-    while (!packet->write_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+    for (std::size_t iteration = 0;
+         !packet->write_ready.exchange(false, std::memory_order::acquire);
+         ++iteration) {
+      detail::backoff<W>(iteration);
     }
     std::allocator_traits<A>::construct(this->allocator, &packet->item,
                                         std::move(item));
     packet->read_ready.store(true, std::memory_order::release);
+    this->filled_count.fetch_add(1, std::memory_order::release);
     this->recv_ready.release();
     return {};
   }
 
-  std::optional<T> do_recv() {
-    Packet<T> *packet;
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    if (this->disconnected.load(std::memory_order::relaxed)) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    PacketChunk<T, CHUNK_SIZE> *chunk;
+    std::size_t index;
     {
-      std::lock_guard _lock(this->head_position_mutex);
-      if (this->send_done() && this->head_chunk == this->tail_chunk &&
-          this->head_index == this->tail_index) {
-        return {};
+      std::lock_guard _lock(this->tail_position_mutex);
+      auto size = this->size.fetch_add(n, std::memory_order::acquire);
+      chunk = this->tail_chunk;
+      index = this->tail_index;
+      for (std::size_t offset = 0; offset < n; ++offset) {
+        this->advance_tail(size + offset);
+      }
+      this->tail_count.fetch_add(n, std::memory_order::release);
+    }
+    // The links between the reserved chunks were made while holding the lock
+    // and won't change until the reserved packets are received.
+    for (std::size_t offset = 0; offset < n; ++offset, ++first) {
+      if (index == CHUNK_SIZE) {
+        index = 0;
+        chunk = chunk->next;
+      }
+      auto &packet = chunk->packets[index++];
+      for (std::size_t iteration = 0;
+           !packet.write_ready.exchange(false, std::memory_order::acquire);
+           ++iteration) {
+        detail::backoff<W>(iteration);
       }
-      packet = &this->head_chunk->packets[this->head_index];
-      if (this->head_index != CHUNK_SIZE - 1) {
-        ++this->head_index;
+      std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                          std::ranges::iter_move(first));
+      packet.read_ready.store(true, std::memory_order::release);
+    }
+    this->filled_count.fetch_add(n, std::memory_order::release);
+    this->recv_ready.release(static_cast<std::ptrdiff_t>(n));
+    return {std::move(first), n, false};
+  }
+
+  /// Move past the packet that was just claimed at the tail. `size` is the
+  /// number of items that were in the channel before it.
+  ///
+  /// Call while holding `tail_position_mutex`, before adding the claimed
+  /// packets to `tail_count`.
+  void advance_tail(std::size_t size) {
+    if (this->tail_index != CHUNK_SIZE - 1) {
+      ++this->tail_index;
+    } else {
+      this->tail_index = 0;
+      if (size < this->capacity.load(std::memory_order::relaxed) - CHUNK_SIZE) {
+        this->tail_chunk = this->tail_chunk->next;
       } else {
-        this->head_index = 0;
-        this->head_chunk = this->head_chunk->next;
+        this->tail_chunk = this->allocate_batch(this->tail_chunk);
       }
+      this->free_idle_chunks(
+          this->idle_chunk_limit.load(std::memory_order::relaxed));
+    }
+  }
+
+  /// Link a batch of new chunks into the ring after `chunk` and return the
+  /// first one.
+  ///
+  /// The batch has as many chunks as the ring, but no more than
+  /// `max_batch_size` or `idle_chunk_limit`.
+  ///
+  /// Call while holding `tail_position_mutex`.
+  PacketChunk<T, CHUNK_SIZE> *
+  allocate_batch(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    auto batch_size = std::max<std::size_t>(
+        std::min({this->capacity.load(std::memory_order::relaxed) / CHUNK_SIZE,
+                  this->max_batch_size.load(std::memory_order::relaxed),
+                  this->idle_chunk_limit.load(std::memory_order::relaxed)}),
+        1);
+    auto batch =
+        std::allocator_traits<A>::allocate(this->allocator, batch_size);
+    for (std::size_t offset = 0; offset < batch_size; ++offset) {
+      this->construct_flags(batch + offset);
+      batch[offset].next = batch + offset + 1;
+      batch[offset].batch = batch;
+    }
+    batch->batch_size = batch_size;
+    batch->freed_count = 0;
+    batch[batch_size - 1].next = chunk->next;
+    chunk->next = batch;
+    this->capacity.fetch_add(batch_size * CHUNK_SIZE,
+                             std::memory_order::relaxed);
+    return batch;
+  }
+
+  /// Free the idle chunks after the tail chunk, except for the first `keep`.
+  ///
+  /// Call while holding `tail_position_mutex`.
+  void free_idle_chunks(std::size_t keep) {
+    // The packets the calling sender claimed are not in `tail_count` yet and
+    // are all at or before the tail chunk.
+    if (this->filled_count.load(std::memory_order::acquire) !=
+        this->tail_count.load(std::memory_order::relaxed)) {
+      return;
     }
-    while (!packet->read_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+    // Every packet between the tail and head chunks has been claimed, but a
+    // receiver may still be emptying one after the head has moved on. A stale
+    // head is further back and only makes this keep more chunks.
+    auto head_chunk = this->head_chunk.load(std::memory_order::acquire);
+    auto chunk = this->tail_chunk;
+    for (; keep != 0 && this->is_idle(chunk->next, head_chunk); --keep) {
+      chunk = chunk->next;
     }
-    auto item = std::move(packet->item);
-    std::allocator_traits<A>::destroy(this->allocator, &packet->item);
-    packet->write_ready.store(true, std::memory_order::release);
+    while (this->is_idle(chunk->next, head_chunk)) {
+      auto idle_chunk = chunk->next;
+      chunk->next = idle_chunk->next;
+      this->free_chunk(idle_chunk);
+      this->capacity.fetch_sub(CHUNK_SIZE, std::memory_order::relaxed);
+    }
+  }
+
+  static bool is_idle(PacketChunk<T, CHUNK_SIZE> *chunk,
+                      PacketChunk<T, CHUNK_SIZE> *head_chunk) {
+    return chunk != head_chunk &&
+           std::ranges::all_of(chunk->packets, [](const auto &packet) {
+             return packet.write_ready.load(std::memory_order::acquire);
+           });
+  }
+
+  void shrink_to_fit() {
+    std::lock_guard _lock(this->tail_position_mutex);
+    this->free_idle_chunks(0);
+  }
+
+  void construct_flags(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    for (auto &packet : chunk->packets) {
+      std::allocator_traits<A>::construct(this->allocator, &packet.read_ready,
+                                          false);
+      std::allocator_traits<A>::construct(this->allocator, &packet.write_ready,
+                                          true);
+    }
+  }
+
+  /// Free `chunk`, and deallocate the chunks it was allocated with once they
+  /// have all been freed.
+  void free_chunk(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    for (auto &packet : chunk->packets) {
+      std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
+      std::allocator_traits<A>::destroy(this->allocator, &packet.write_ready);
+    }
+    auto batch = chunk->batch;
+    if (++batch->freed_count == batch->batch_size) {
+      std::allocator_traits<A>::deallocate(this->allocator, batch,
+                                           batch->batch_size);
+    }
+  }
+
+  std::optional<T> do_recv() {
+    PacketChunk<T, CHUNK_SIZE> *chunk;
+    std::size_t index;
+    if (this->claim_head(chunk, index, 1) == 0) {
+      return {};
+    }
+    auto &packet = chunk->packets[index];
+    for (std::size_t iteration = 0;
+         !packet.read_ready.exchange(false, std::memory_order::acquire);
+         ++iteration) {
+      detail::backoff<W>(iteration);
+    }
+    auto item = std::move(packet.item);
+    std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+    packet.write_ready.store(true, std::memory_order::release);
     this->size.fetch_sub(1, std::memory_order::release);
     return item;
   }
 
+  template <typename O> std::size_t do_recv_n(O &out, std::size_t n) {
+    std::size_t count = 0;
+    while (count != n) {
+      PacketChunk<T, CHUNK_SIZE> *chunk;
+      std::size_t index;
+      auto claimed = this->claim_head(chunk, index, n - count);
+      if (claimed == 0) {
+        break;
+      }
+      for (auto end = index + claimed; index != end; ++index, ++out) {
+        auto &packet = chunk->packets[index];
+        for (std::size_t iteration = 0;
+             !packet.read_ready.exchange(false, std::memory_order::acquire);
+             ++iteration) {
+          detail::backoff<W>(iteration);
+        }
+        *out = std::move(packet.item);
+        std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+        packet.write_ready.store(true, std::memory_order::release);
+      }
+      count += claimed;
+    }
+    // Claimed packets counted towards the size until now, so their chunks
+    // could not be reused.
+    this->size.fetch_sub(count, std::memory_order::release);
+    return count;
+  }
+
+  /// Claim between 1 and `n` packets in a row at the head, all in the same
+  /// chunk, but no more than `tail_count` allows.
+  ///
+  /// Sets `chunk` and `index` to the first claimed packet and returns the
+  /// number of packets claimed, or 0 if every sent packet is already claimed.
+  std::size_t claim_head(PacketChunk<T, CHUNK_SIZE> *&chunk, std::size_t &index,
+                         std::size_t n) {
+    auto position = this->head_position.load(std::memory_order::acquire);
+    for (std::size_t iteration = 0;; ++iteration) {
+      index = position % LAP;
+      if (index == CHUNK_SIZE) {
+        // Another receiver is moving the head to the next chunk.
+        detail::backoff<W>(iteration);
+        position = this->head_position.load(std::memory_order::acquire);
+        continue;
+      }
+      // The head chunk only changes while the position is at the end of a
+      // lap, so it matches `position` if the compare-exchange succeeds.
+      chunk = this->head_chunk.load(std::memory_order::acquire);
+      auto head_count = position / LAP * CHUNK_SIZE + index;
+      auto tail_count = this->tail_count.load(std::memory_order::acquire);
+      if (tail_count <= head_count) {
+        return 0;
+      }
+      auto claimed = std::min({n, CHUNK_SIZE - index, tail_count - head_count});
+      if (this->head_position.compare_exchange_weak(
+              position, position + claimed, std::memory_order::acq_rel,
+              std::memory_order::acquire)) {
+        if (index + claimed == CHUNK_SIZE) {
+          // The next chunk was linked before the last packet of this one was
+          // counted in `tail_count`.
+          this->head_chunk.store(chunk->next, std::memory_order::release);
+          this->head_position.store(position + claimed + 1,
+                                    std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
   bool send_done() const {
     return this->sender_count.load(std::memory_order::acquire) == 0;
   }
@@ -2,10 +2,17 @@
 #define _CHAN_MPMC_UNBOUNDED_RECEIVER_H
 
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <span>
 
 #include "../../DEFAULT_CHUNK_SIZE.hpp"
 #include "../../RecvIter.hpp"
+#include "../../Select.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 
 namespace chan::mpmc::unbounded {
@@ -14,6 +21,7 @@ namespace chan::mpmc::unbounded {
 /// # Template parameters
 /// `T` - Channel's item type
 /// `CHUNK_SIZE` (optional) - Size of the channel's item chunks
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Allocator for the channel's item chunks
 /// `A2` (optional) - Allocator for the channel object
 ///
@@ -21,9 +29,12 @@ namespace chan::mpmc::unbounded {
 /// Do not share a `Receiver` between threads. If multiple threads need to
 /// receive from the same channel, give each thread a its own `Receiver` copy.
 template <typename T, std::size_t CHUNK_SIZE = DEFAULT_CHUNK_SIZE,
+          typename W = wait::Park,
           typename A1 = std::allocator<PacketChunk<T, CHUNK_SIZE>>,
-          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, A1>>>
+          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, W, A1>>>
 class Receiver {
+  friend class chan::Select;
+
 public:
   using Item = T;
 
@@ -92,9 +103,6 @@ public:
 
   /// Receive an item from the channel without blocking.
   ///
-  /// Because semaphore try_acquire operations may spuriously fail, this
-  /// function may spuriously fail with `TryRecvErrorKind::Empty`.
-  ///
   /// # Safety
   /// Causes undefined behavior if `is_null()` is `true`.
   std::expected<T, TryRecvError> try_recv() const {
@@ -130,6 +138,66 @@ public:
     return this->channel->try_recv_until(deadline);
   }
 
+  /// Receive an item from the channel in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until the
+  /// channel is not empty or all senders disconnect, then returns what `recv()`
+  /// would have returned. The coroutine is resumed by a function object that is
+  /// passed to `executor`, which must queue it to run on some thread rather
+  /// than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Receive up to `items.size()` items from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect. Then
+  /// takes as many items as are available, up to `items.size()`, in a single
+  /// step.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, RecvError> recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->recv_n(items.begin(), items.size());
+  }
+
+  /// Receive up to `items.size()` items from the channel without blocking.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, TryRecvError>
+  try_recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(items.begin(), items.size());
+  }
+
+  /// Move up to `limit` items from the channel to `out` without blocking.
+  ///
+  /// Returns the number of items received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::weakly_incrementable O>
+    requires std::indirectly_writable<O, T>
+  std::expected<std::size_t, TryRecvError>
+  drain_into(O out, std::size_t limit =
+                        std::numeric_limits<std::size_t>::max()) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(std::move(out), limit);
+  }
+
   /// Number of items in the channel.
   ///
   /// Since the channel's size could change at any moment, it should not be used
@@ -151,6 +219,45 @@ public:
     return this->channel->capacity.load(std::memory_order::relaxed);
   }
 
+  /// Free the channel's idle chunks.
+  ///
+  /// Chunks that still hold items, or that another thread is still using, are
+  /// kept, so the channel's capacity may stay above its size.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  void shrink_to_fit() const {
+    assert(this->channel != nullptr);
+    this->channel->shrink_to_fit();
+  }
+
+  /// Set how many idle chunks the channel keeps for reuse.
+  ///
+  /// Extra idle chunks are freed the next time a sender moves to a new chunk.
+  /// The channel also never allocates more than `limit` chunks at once. By
+  /// default, the channel keeps every chunk it allocates.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  void set_idle_chunk_limit(std::size_t limit) const {
+    assert(this->channel != nullptr);
+    this->channel->idle_chunk_limit.store(limit, std::memory_order::relaxed);
+  }
+
+  /// Set how many chunks the channel allocates at once.
+  ///
+  /// When the channel is full, it grows by as many chunks as it already has,
+  /// up to `count`, in a single allocation. Setting this to 1 makes the
+  /// channel allocate one chunk at a time. The default is
+  /// `DEFAULT_MAX_CHUNKS_PER_ALLOCATION`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  void set_max_chunks_per_allocation(std::size_t count) const {
+    assert(this->channel != nullptr);
+    this->channel->max_batch_size.store(count, std::memory_order::relaxed);
+  }
+
   /// Disconnect from the channel.
   ///
   /// There is often no need to call this function because the destructor will
@@ -176,6 +283,10 @@ private:
     }
   }
 
+  detail::WakerList &wakers() const {
+    return this->channel->recv_ready.wakers();
+  }
+
 public:
   RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
 
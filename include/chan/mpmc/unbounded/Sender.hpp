@@ -2,10 +2,19 @@
 #define _CHAN_MPMC_UNBOUNDED_SENDER_H
 
 #include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <ranges>
+#include <utility>
 
 #include "../../DEFAULT_CHUNK_SIZE.hpp"
 #include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 
 namespace chan::mpmc::unbounded {
@@ -14,6 +23,7 @@ namespace chan::mpmc::unbounded {
 /// # Template parameters
 /// `T` - Channel's item type
 /// `CHUNK_SIZE` (optional) - Size of the channel's item chunks
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Allocator for the channel's item chunks
 /// `A2` (optional) - Allocator for the channel object
 ///
@@ -21,8 +31,9 @@ namespace chan::mpmc::unbounded {
 /// Do not share a `Sender` between threads. If multiple threads need to
 /// send to the same channel, give each thread a its own `Sender` copy.
 template <typename T, std::size_t CHUNK_SIZE = DEFAULT_CHUNK_SIZE,
+          typename W = wait::Park,
           typename A1 = std::allocator<PacketChunk<T, CHUNK_SIZE>>,
-          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, A1>>>
+          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, W, A1>>>
 class Sender {
 public:
   using Item = T;
@@ -90,6 +101,54 @@ public:
     return this->channel->send(std::move(item));
   }
 
+  /// Send an item on the channel in a coroutine.
+  ///
+  /// Sending never blocks, so `co_await tx.async_send(item, executor)` never
+  /// suspends the coroutine and does not use `executor`. It returns what
+  /// `send(item)` would have returned.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename E> auto async_send(T item, E) const {
+    return detail::ReadyAwaiter(this->send(std::move(item)));
+  }
+
+  /// Send every item in a range on the channel.
+  ///
+  /// Items are moved out of the range. Does not block. Space for all of the
+  /// items is reserved at once, so a batch costs about as much synchronization
+  /// as a single item.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
   /// Number of items in the channel.
   ///
   /// # Safety
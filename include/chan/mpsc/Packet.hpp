@@ -3,14 +3,19 @@
 
 #include <atomic>
 
+#include "../detail/CACHE_LINE_SIZE.hpp"
+
 namespace chan::mpsc {
 /// Item with a synchronization flag.
 ///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
 template <typename T> struct Packet {
-  T item;
+  alignas(detail::PACKET_ALIGNMENT) alignas(T) T item;
   std::atomic_bool read_ready;
+  /// Set before `read_ready` when a reserved packet is abandoned without an
+  /// item, so the receiver skips it.
+  bool abandoned;
 };
 } // namespace chan::mpsc
 
@@ -2,34 +2,47 @@
 #define _CHAN_MPSC_BOUNDED_CHANNEL_H
 
 #include <atomic>
+#include <iterator>
 #include <memory>
 #include <optional>
-#include <thread>
+#include <utility>
 
+#include "../../RecvView.hpp"
+#include "../../SendSlot.hpp"
 #include "../../detail/BoundedChannel.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/Semaphore.hpp"
+#include "../../detail/backoff.hpp"
 #include "../Packet.hpp"
 
 namespace chan::mpsc::bounded {
 /// Channel implementation.
 ///
+/// A reserved packet that is abandoned is published without an item and is
+/// not counted in `size`. It still releases a `recv_ready` permit, so the
+/// receiver wakes up to move past it and give its slot back to senders.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, typename A>
-class Chan : detail::BoundedChannel<Chan<T, A>, T> {
+template <typename T, typename W, typename A>
+class Chan : detail::BoundedChannel<Chan<T, W, A>, T> {
   friend struct detail::BoundedChannel<Chan, T>;
-  template <typename, typename, typename> friend class Sender;
-  template <typename, typename, typename> friend class Receiver;
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
+  template <typename, typename> friend class chan::SendSlot;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = Packet<T> *;
 
   A allocator;
   std::allocator_traits<A>::pointer packet_buffer;
   std::size_t capacity;
-  std::size_t head_index;
-  std::atomic_size_t tail_index;
-  std::atomic_size_t size;
-  detail::SemaphoreType send_ready;
-  detail::SemaphoreType recv_ready;
-  std::atomic_size_t sender_count;
+  alignas(detail::CACHE_LINE_SIZE) std::size_t head_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t size;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
   std::atomic_bool _recv_done;
   std::atomic_bool disconnected;
 
@@ -48,6 +61,8 @@ public:
     for (std::size_t index = 0; index < capacity; ++index) {
       std::allocator_traits<A>::construct(
           this->allocator, &this->packet_buffer[index].read_ready, false);
+      std::allocator_traits<A>::construct(
+          this->allocator, &this->packet_buffer[index].abandoned, false);
     }
   }
 
@@ -55,8 +70,10 @@ public:
     auto index = this->head_index;
     auto tail_index = this->tail_index.load(std::memory_order::relaxed);
     while (index != tail_index) {
-      std::allocator_traits<A>::destroy(this->allocator,
-                                        &this->packet_buffer[index].item);
+      if (!this->packet_buffer[index].abandoned) {
+        std::allocator_traits<A>::destroy(this->allocator,
+                                          &this->packet_buffer[index].item);
+      }
       if (++index == this->capacity) {
         index = 0;
       }
@@ -65,6 +82,8 @@ public:
     for (std::size_t index = 0; index < this->capacity; ++index) {
       std::allocator_traits<A>::destroy(this->allocator,
                                         &this->packet_buffer[index].read_ready);
+      std::allocator_traits<A>::destroy(this->allocator,
+                                        &this->packet_buffer[index].abandoned);
     }
 
     std::allocator_traits<A>::deallocate(this->allocator, this->packet_buffer,
@@ -73,30 +92,129 @@ public:
 
 private:
   void do_send(T item) {
+    auto packet = this->do_reserve();
+    std::allocator_traits<A>::construct(this->allocator, &packet->item,
+                                        std::move(item));
+    this->do_commit_slot(packet);
+  }
+
+  /// Claim the packet at the tail. Call after acquiring a `send_ready`
+  /// permit.
+  Packet<T> *do_reserve() {
     std::size_t tail_index;
     do {
       tail_index = this->tail_index.load(std::memory_order::relaxed);
     } while (!this->tail_index.compare_exchange_weak(
         tail_index, tail_index == this->capacity - 1 ? 0 : tail_index + 1,
         std::memory_order::relaxed));
+    return std::to_address(this->packet_buffer + tail_index);
+  }
 
-    auto &packet = this->packet_buffer[tail_index];
-    std::allocator_traits<A>::construct(this->allocator, &packet.item,
-                                        std::move(item));
-    packet.read_ready.store(true, std::memory_order::release);
+  template <typename... Args>
+  void construct_slot(Packet<T> *packet, Args &&...args) {
+    std::allocator_traits<A>::construct(this->allocator, &packet->item,
+                                        std::forward<Args>(args)...);
+  }
+
+  void do_commit_slot(Packet<T> *packet) {
+    packet->read_ready.store(true, std::memory_order::release);
+  }
+
+  void do_abandon_slot(Packet<T> *packet) {
+    // The packet already has its place in the order the receiver reads
+    // packets, so it is published without an item for the receiver to skip.
+    packet->abandoned = true;
+    packet->read_ready.store(true, std::memory_order::release);
+  }
+
+  template <typename I> I do_send_n(I first, std::size_t n) {
+    std::size_t tail_index;
+    do {
+      tail_index = this->tail_index.load(std::memory_order::relaxed);
+    } while (!this->tail_index.compare_exchange_weak(
+        tail_index, (tail_index + n) % this->capacity,
+        std::memory_order::relaxed));
+
+    for (; n != 0; --n, ++first) {
+      auto &packet = this->packet_buffer[tail_index];
+      std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                          std::ranges::iter_move(first));
+      packet.read_ready.store(true, std::memory_order::release);
+      if (++tail_index == this->capacity) {
+        tail_index = 0;
+      }
+    }
+    return first;
   }
 
   T do_recv() {
-    auto &packet = this->packet_buffer[this->head_index];
-    while (!packet.read_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+    auto packet = this->do_peek();
+    auto item = std::move(packet->item);
+    this->do_release_slot(packet);
+    return item;
+  }
+
+  /// Wait for the packet at the head to be published, freeing abandoned
+  /// packets until one has an item. Call after taking an item from `size`.
+  Packet<T> *do_peek() {
+    while (true) {
+      auto packet = std::to_address(this->packet_buffer + this->head_index);
+      for (std::size_t iteration = 0;
+           !packet->read_ready.exchange(false, std::memory_order::acquire);
+           ++iteration) {
+        detail::backoff<W>(iteration);
+      }
+      if (!packet->abandoned) {
+        return packet;
+      }
+      this->free_abandoned(packet);
     }
-    auto item = std::move(packet.item);
-    std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+  }
+
+  void do_release_slot(Packet<T> *packet) {
+    std::allocator_traits<A>::destroy(this->allocator, &packet->item);
     if (++this->head_index == this->capacity) {
       this->head_index = 0;
     }
-    return item;
+    this->do_skip_abandoned();
+  }
+
+  /// Free the abandoned packets that have already been published at the head,
+  /// so their slots don't wait for the next item to be received.
+  void do_skip_abandoned() {
+    while (true) {
+      auto packet = std::to_address(this->packet_buffer + this->head_index);
+      if (!packet->read_ready.load(std::memory_order::acquire) ||
+          !packet->abandoned) {
+        return;
+      }
+      packet->read_ready.store(false, std::memory_order::relaxed);
+      this->free_abandoned(packet);
+    }
+  }
+
+  /// Move past the abandoned packet at the head and give its slot back to
+  /// senders.
+  void free_abandoned(Packet<T> *packet) {
+    packet->abandoned = false;
+    if (++this->head_index == this->capacity) {
+      this->head_index = 0;
+    }
+    this->send_ready.release();
+  }
+
+  static T *slot_item(Packet<T> *packet) { return &packet->item; }
+
+  template <typename O> void do_recv_n(O &out, std::size_t n) {
+    for (; n != 0; --n, ++out) {
+      auto packet = this->do_peek();
+      *out = std::move(packet->item);
+      std::allocator_traits<A>::destroy(this->allocator, &packet->item);
+      if (++this->head_index == this->capacity) {
+        this->head_index = 0;
+      }
+    }
+    this->do_skip_abandoned();
   }
 
   bool send_done() const {
@@ -2,9 +2,17 @@
 #define _CHAN_MPSC_BOUNDED_RECEIVER_H
 
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <span>
 
 #include "../../RecvIter.hpp"
+#include "../../RecvView.hpp"
+#include "../../Select.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 
 namespace chan::mpsc::bounded {
@@ -12,18 +20,25 @@ namespace chan::mpsc::bounded {
 ///
 /// # Template parameters
 /// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Allocator for the channel's item buffer
 /// `A2` (optional) - Allocator for the channel object
 ///
 /// # Safety
 /// Do not share a `Receiver` between threads. If multiple threads need to
 /// receive from the same channel, use mpmc instead of mpsc.
-template <typename T, typename A1 = std::allocator<Packet<T>>,
-          typename A2 = std::allocator<Chan<T, A1>>>
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<Packet<T>>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
 class Receiver {
+  friend class chan::Select;
+
 public:
   using Item = T;
 
+  /// Handle returned by `peek`.
+  using View = RecvView<T, Chan<T, W, A1>>;
+
 private:
   std::allocator_traits<A2>::pointer channel;
   A2 allocator;
@@ -79,9 +94,6 @@ public:
 
   /// Receive an item from the channel without blocking.
   ///
-  /// Because semaphore try_acquire operations may spuriously fail, this
-  /// function may spuriously fail with `TryRecvErrorKind::Empty`.
-  ///
   /// # Safety
   /// Causes undefined behavior if `is_null()` is `true`.
   std::expected<T, TryRecvError> try_recv() const {
@@ -117,6 +129,102 @@ public:
     return this->channel->try_recv_until(deadline);
   }
 
+  /// Receive an item from the channel without moving it out.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect.
+  ///
+  /// The item is read in place through the returned `RecvView` and destroyed
+  /// when the view is released, which saves moving it out of the channel.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<View, RecvError> peek() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->peek();
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return View(channel, *slot);
+  }
+
+  /// Receive an item from the channel without moving it out and without
+  /// blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<View, TryRecvError> try_peek() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->try_peek();
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return View(channel, *slot);
+  }
+
+  /// Receive an item from the channel in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until the
+  /// channel is not empty or all senders disconnect, then returns what `recv()`
+  /// would have returned. The coroutine is resumed by a function object that is
+  /// passed to `executor`, which must queue it to run on some thread rather
+  /// than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Receive up to `items.size()` items from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect. Then
+  /// takes as many items as are available, up to `items.size()`, in a single
+  /// step.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, RecvError> recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->recv_n(items.begin(), items.size());
+  }
+
+  /// Receive up to `items.size()` items from the channel without blocking.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, TryRecvError>
+  try_recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(items.begin(), items.size());
+  }
+
+  /// Move up to `limit` items from the channel to `out` without blocking.
+  ///
+  /// Returns the number of items received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::weakly_incrementable O>
+    requires std::indirectly_writable<O, T>
+  std::expected<std::size_t, TryRecvError>
+  drain_into(O out, std::size_t limit =
+                        std::numeric_limits<std::size_t>::max()) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(std::move(out), limit);
+  }
+
   /// Number of items in the channel.
   ///
   /// Since the channel's size could change at any moment, it should not be used
@@ -157,6 +265,10 @@ private:
     }
   }
 
+  detail::WakerList &wakers() const {
+    return this->channel->recv_ready.wakers();
+  }
+
 public:
   RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
 
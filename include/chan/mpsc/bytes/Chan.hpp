@@ -0,0 +1,183 @@
+#ifndef _CHAN_MPSC_BYTES_CHANNEL_H
+#define _CHAN_MPSC_BYTES_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "../../RecvView.hpp"
+#include "../../detail/ByteRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+
+namespace chan::mpsc::bytes {
+/// Channel implementation.
+///
+/// `head_index` and `tail_index` count the bytes received and claimed so far,
+/// including padding. A sender claims room for its frame, and for padding up
+/// to the end of the buffer if the frame doesn't fit there, with a single
+/// compare-exchange on `tail_index`. It then copies the message and publishes
+/// the frame by storing its header, so frames can be published out of order.
+/// The receiver reads the header at its offset and treats zero as not
+/// published yet. Before freeing a frame, the receiver zeroes it, so every
+/// header position in free space reads as zero when a sender claims it.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename W, typename A>
+class Chan : detail::ByteRingChannel<Chan<W, A>> {
+  friend struct detail::ByteRingChannel<Chan>;
+  template <typename, typename, typename> friend class Sender;
+  template <typename, typename, typename> friend class Receiver;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = detail::ByteRingChannel<Chan>::Slot;
+
+  A allocator;
+  std::size_t capacity;
+  std::allocator_traits<A>::pointer buffer;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  std::size_t head_offset;
+
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
+  std::atomic_bool _recv_done;
+  std::atomic_bool disconnected;
+
+  static_assert(std::atomic_ref<std::size_t>::is_always_lock_free);
+
+public:
+  /// Create a channel that assumes a single `Sender` and single `Receiver`.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(std::size_t capacity, A allocator)
+      : allocator(std::move(allocator)),
+        capacity(this->buffer_size(capacity)),
+        buffer(std::allocator_traits<A>::allocate(this->allocator,
+                                                  this->capacity)),
+        tail_index(0), head_index(0), head_offset(0), sender_count(1),
+        _recv_done(false), disconnected(false) {
+    std::memset(this->data(), 0, this->capacity);
+  }
+
+  ~Chan() {
+    std::allocator_traits<A>::deallocate(this->allocator, this->buffer,
+                                         this->capacity);
+  }
+
+private:
+  bool try_do_send(std::span<const std::byte> message) {
+    auto frame_size = this->frame_size(message.size());
+    // Load the head first so the tail can't be behind it. The head is not
+    // reloaded when the compare-exchange fails, so the tail may get more than
+    // `capacity` ahead of it, which only makes the channel look fuller.
+    auto head_index = this->head_index.load(std::memory_order::acquire);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    std::size_t offset;
+    std::size_t skipped;
+    do {
+      offset = tail_index % this->capacity;
+      skipped =
+          frame_size <= this->capacity - offset ? 0 : this->capacity - offset;
+      if (tail_index - head_index + skipped + frame_size > this->capacity) {
+        return false;
+      }
+    } while (!this->tail_index.compare_exchange_weak(
+        tail_index, tail_index + skipped + frame_size,
+        std::memory_order::relaxed));
+    if (skipped != 0) {
+      this->header(offset).store(this->PADDING, std::memory_order::release);
+      offset = 0;
+    }
+    std::ranges::copy(message, this->data() + offset + this->HEADER_SIZE);
+    this->header(offset).store(message.size() + 1, std::memory_order::release);
+    return true;
+  }
+
+  bool try_do_recv(Slot &slot) {
+    auto offset = this->head_offset;
+    std::size_t skipped = 0;
+    auto header = this->header(offset).load(std::memory_order::acquire);
+    if (header == this->PADDING) {
+      skipped = this->capacity - offset;
+      offset = 0;
+      header = this->header(offset).load(std::memory_order::acquire);
+    }
+    if (header == 0) {
+      return false;
+    }
+    auto size = header - 1;
+    slot = {{this->data() + offset + this->HEADER_SIZE, size},
+            skipped + this->frame_size(size)};
+    return true;
+  }
+
+  void do_release_slot(const Slot &slot) {
+    auto frame_size = this->frame_size(slot.message.size());
+    if (slot.size != frame_size) {
+      // Only the padding's header was written.
+      std::memset(this->data() + this->head_offset, 0, this->HEADER_SIZE);
+      this->head_offset = 0;
+    }
+    std::memset(this->data() + this->head_offset, 0, frame_size);
+    this->head_offset += frame_size;
+    if (this->head_offset == this->capacity) {
+      this->head_offset = 0;
+    }
+    this->head_index.store(
+        this->head_index.load(std::memory_order::relaxed) + slot.size,
+        std::memory_order::release);
+  }
+
+  std::byte *data() const { return std::to_address(this->buffer); }
+
+  std::atomic_ref<std::size_t> header(std::size_t offset) const {
+    return std::atomic_ref(
+        *reinterpret_cast<std::size_t *>(this->data() + offset));
+  }
+
+  std::size_t size() const {
+    auto head_index = this->head_index.load(std::memory_order::acquire);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
+  bool send_done() const {
+    return this->sender_count.load(std::memory_order::acquire) == 0;
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire);
+  }
+
+  void acquire_sender() {
+    this->sender_count.fetch_add(1, std::memory_order::relaxed);
+  }
+
+  bool release_sender() {
+    if (this->sender_count.fetch_sub(1, std::memory_order::acq_rel) != 1) {
+      return false;
+    }
+    this->recv_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver() {
+    this->_recv_done.store(true, std::memory_order::release);
+    this->send_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::mpsc::bytes
+
+#endif
@@ -0,0 +1,202 @@
+#ifndef _CHAN_MPSC_BYTES_SENDER_H
+#define _CHAN_MPSC_BYTES_SENDER_H
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "../../SendError.hpp"
+#include "../../TrySendError.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::mpsc::bytes {
+/// Sending half of a channel.
+///
+/// # Template parameters
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's byte buffer
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Sender` between threads. If multiple threads need to
+/// send to the same channel, give each thread its own `Sender` copy.
+template <typename W = wait::Park, typename A1 = std::allocator<std::byte>,
+          typename A2 = std::allocator<Chan<W, A1>>>
+class Sender {
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Sender(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Sender`.
+  Sender() : channel(nullptr), allocator() {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &other)
+      : channel(other.channel), allocator(other.allocator) {
+    this->acquire();
+  }
+
+  Sender &operator=(const Sender &other) {
+    this->release();
+    this->channel = other.channel;
+    this->allocator = other.allocator;
+    this->acquire();
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Copy a message into the channel.
+  ///
+  /// Blocks until the channel has room for the message or the receiver
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or
+  /// `message.size() > max_message_size()`.
+  std::expected<void, SendError<void>>
+  send(std::span<const std::byte> message) const {
+    assert(this->channel != nullptr);
+    assert(message.size() <= this->max_message_size());
+    return this->channel->send(message);
+  }
+
+  /// Copy a message into the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or
+  /// `message.size() > max_message_size()`.
+  std::expected<void, TrySendError<void>>
+  try_send(std::span<const std::byte> message) const {
+    assert(this->channel != nullptr);
+    assert(message.size() <= this->max_message_size());
+    return this->channel->try_send(message);
+  }
+
+  /// Copy a message into the channel with a timeout.
+  ///
+  /// Blocks until the channel has room for the message, the timeout is met,
+  /// or the receiver disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or
+  /// `message.size() > max_message_size()`.
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<void>>
+  try_send_for(std::span<const std::byte> message,
+               const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    assert(message.size() <= this->max_message_size());
+    return this->channel->try_send_for(message, timeout);
+  }
+
+  /// Copy a message into the channel with a deadline.
+  ///
+  /// Blocks until the channel has room for the message, the deadline is met,
+  /// or the receiver disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or
+  /// `message.size() > max_message_size()`.
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<void>> try_send_until(
+      std::span<const std::byte> message,
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    assert(message.size() <= this->max_message_size());
+    return this->channel->try_send_until(message, deadline);
+  }
+
+  /// Size in bytes of the largest message that can be sent, which is a little
+  /// under half of `channel_capacity()`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t max_message_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->max_message_size(this->channel->capacity);
+  }
+
+  /// Number of bytes that messages in the channel take up, including their
+  /// headers and padding.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a send operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Number of bytes the channel has allocated for messages.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire() {
+    if (this->channel) {
+      this->channel->acquire_sender();
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_sender()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+};
+} // namespace chan::mpsc::bytes
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef _CHAN_MPSC_BYTES_CREATE_H
+#define _CHAN_MPSC_BYTES_CREATE_H
+
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::mpsc::bytes {
+/// Create a new channel of byte messages and get a `Sender` and `Receiver`
+/// for it.
+///
+/// # Parameters
+/// `capacity` - Size in bytes of the channel's buffer, which holds each
+/// message with a header and padding. It is rounded up to whole headers.
+/// `buffer_allocator` (optional) - Allocator for the channel's byte buffer
+/// `channel_allocator` (optional) - Allocator for the channel object
+///
+/// # Template parameters
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Type of `buffer_allocator` parameter
+/// `A2` (optional) - Type of `channel_allocator` parameter
+template <typename W = wait::Park, typename A1 = std::allocator<std::byte>,
+          typename A2 = std::allocator<Chan<W, A1>>>
+std::pair<Sender<W, A1, A2>, Receiver<W, A1, A2>>
+channel(std::size_t capacity, A1 buffer_allocator = A1(),
+        A2 channel_allocator = A2()) {
+  auto channel = std::allocator_traits<A2>::allocate(channel_allocator, 1);
+  std::allocator_traits<A2>::construct(channel_allocator, channel, capacity,
+                                       std::move(buffer_allocator));
+
+  Sender<W, A1, A2> sender(channel, channel_allocator);
+  Receiver<W, A1, A2> receiver(std::move(channel),
+                               std::move(channel_allocator));
+
+  return {std::move(sender), std::move(receiver)};
+}
+} // namespace chan::mpsc::bytes
+
+#endif
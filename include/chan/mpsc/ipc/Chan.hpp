@@ -0,0 +1,257 @@
+#ifndef _CHAN_MPSC_IPC_CHANNEL_H
+#define _CHAN_MPSC_IPC_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+
+#include "../../detail/BoundedRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/SharedEventCount.hpp"
+#include "../../detail/SharedMemory.hpp"
+#include "Packet.hpp"
+
+namespace chan::mpsc::ipc {
+/// Channel implementation, placed at the start of a shared memory object and
+/// followed by the packet buffer.
+///
+/// Senders claim positions the same way as in `mpmc::bounded::Chan`. There is
+/// only one receiver, so it moves `head_index` without a compare-exchange.
+/// Nothing in the object is a pointer, so every process can map it at a
+/// different address.
+///
+/// `sender_state` counts the connected senders. When the last one
+/// disconnects, it is replaced with `SENDERS_GONE` so no sender can connect
+/// to a channel that the receiver already considers disconnected.
+///
+/// There is no reason to work with this class directly.
+template <typename T, typename W>
+class Chan : detail::BoundedRingChannel<Chan<T, W>, T> {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "items are copied between processes byte by byte");
+  static_assert(alignof(Packet<T>) <= detail::CACHE_LINE_SIZE);
+  static_assert(std::atomic_size_t::is_always_lock_free);
+
+  friend struct detail::BoundedRingChannel<Chan, T>;
+  template <typename, typename> friend class Sender;
+  template <typename, typename> friend class Receiver;
+
+  static constexpr std::uint32_t MAGIC = 0x63686d31;
+  static constexpr std::uint32_t SENDERS_GONE = std::uint32_t(1) << 31;
+
+  std::atomic_uint32_t magic;
+  std::uint32_t layout_size;
+  std::size_t item_size;
+  std::size_t packet_size;
+  std::size_t capacity;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  alignas(detail::CACHE_LINE_SIZE) detail::SharedEventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::SharedEventCount<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_uint32_t sender_state;
+  std::atomic_uint32_t _recv_done;
+
+public:
+  /// Number of bytes of shared memory for a channel of `capacity` items.
+  static std::size_t memory_size(std::size_t capacity) {
+    return sizeof(Chan) + capacity * sizeof(Packet<T>);
+  }
+
+  /// Construct a channel at the start of `memory`, which must hold at least
+  /// `memory_size(capacity)` bytes.
+  static Chan *create(const detail::SharedMemory &memory,
+                      std::size_t capacity) {
+    auto channel = ::new (memory.data()) Chan(capacity);
+    channel->magic.store(MAGIC, std::memory_order::release);
+    return channel;
+  }
+
+  /// Get the channel that another process constructed in `memory`.
+  ///
+  /// Throws `std::system_error` if `memory` does not hold a channel of this
+  /// type, or one that is not fully constructed yet.
+  static Chan *open(const detail::SharedMemory &memory) {
+    auto channel = static_cast<Chan *>(memory.data());
+    if (memory.size() < sizeof(Chan) ||
+        channel->magic.load(std::memory_order::acquire) != MAGIC ||
+        channel->layout_size != sizeof(Chan) ||
+        channel->item_size != sizeof(T) ||
+        channel->packet_size != sizeof(Packet<T>) ||
+        memory.size() < memory_size(channel->capacity)) {
+      throw std::system_error(
+          std::make_error_code(std::errc::invalid_argument),
+          "not a chan::mpsc::ipc channel of this type");
+    }
+    return channel;
+  }
+
+  /// Add a sender.
+  ///
+  /// Returns `false` if every sender has already disconnected.
+  bool connect_sender() {
+    auto state = this->sender_state.load(std::memory_order::relaxed);
+    while (state != SENDERS_GONE) {
+      if (this->sender_state.compare_exchange_weak(
+              state, state + 1, std::memory_order::acquire,
+              std::memory_order::relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  explicit Chan(std::size_t capacity)
+      : layout_size(sizeof(Chan)), item_size(sizeof(T)),
+        packet_size(sizeof(Packet<T>)), capacity(capacity), head_index(0),
+        tail_index(0), sender_state(0), _recv_done(0) {
+    for (std::size_t index = 0; index < capacity; ++index) {
+      std::construct_at(&this->packet_buffer()[index].sequence, 2 * index);
+    }
+  }
+
+  Packet<T> *packet_buffer() {
+    return reinterpret_cast<Packet<T> *>(reinterpret_cast<std::byte *>(this) +
+                                         sizeof(Chan));
+  }
+
+  bool try_do_send(T &item) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    while (true) {
+      auto &packet = this->packet_buffer()[tail_index % this->capacity];
+      auto sequence = packet.sequence.load(std::memory_order::acquire);
+      auto lag = static_cast<std::ptrdiff_t>(sequence - 2 * tail_index);
+      if (lag == 0) {
+        if (this->tail_index.compare_exchange_weak(
+                tail_index, tail_index + 1, std::memory_order::relaxed)) {
+          std::construct_at(&packet.item, std::move(item));
+          packet.sequence.store(2 * tail_index + 1, std::memory_order::release);
+          return true;
+        }
+      } else if (lag < 0) {
+        // The packet still holds the item from the previous lap.
+        return false;
+      } else {
+        tail_index = this->tail_index.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  template <typename I> std::size_t try_do_send_n(I &first, std::size_t n) {
+    n = std::min(n, this->capacity);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    while (true) {
+      // Count the free packets in a row starting at the tail. Only the sender
+      // that moves the tail past a free packet can fill it, so they stay free
+      // if the compare-exchange succeeds.
+      std::size_t claimed = 0;
+      std::ptrdiff_t lag = 0;
+      while (claimed < n) {
+        auto index = tail_index + claimed;
+        auto sequence = this->packet_buffer()[index % this->capacity]
+                            .sequence.load(std::memory_order::acquire);
+        lag = static_cast<std::ptrdiff_t>(sequence - 2 * index);
+        if (lag != 0) {
+          break;
+        }
+        ++claimed;
+      }
+      if (claimed == 0) {
+        if (lag < 0) {
+          return 0;
+        }
+        tail_index = this->tail_index.load(std::memory_order::relaxed);
+        continue;
+      }
+      if (this->tail_index.compare_exchange_weak(tail_index,
+                                                 tail_index + claimed,
+                                                 std::memory_order::relaxed)) {
+        for (std::size_t offset = 0; offset < claimed; ++offset, ++first) {
+          auto index = tail_index + offset;
+          auto &packet = this->packet_buffer()[index % this->capacity];
+          std::construct_at(&packet.item, std::ranges::iter_move(first));
+          packet.sequence.store(2 * index + 1, std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  std::optional<T> try_do_recv() {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    auto &packet = this->packet_buffer()[head_index % this->capacity];
+    if (packet.sequence.load(std::memory_order::acquire) !=
+        2 * head_index + 1) {
+      return {};
+    }
+    std::optional<T> item(packet.item);
+    this->head_index.store(head_index + 1, std::memory_order::relaxed);
+    packet.sequence.store(2 * (head_index + this->capacity),
+                          std::memory_order::release);
+    return item;
+  }
+
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    n = std::min(n, this->capacity);
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    std::size_t received = 0;
+    for (; received < n; ++received, ++out) {
+      auto index = head_index + received;
+      auto &packet = this->packet_buffer()[index % this->capacity];
+      if (packet.sequence.load(std::memory_order::acquire) != 2 * index + 1) {
+        break;
+      }
+      *out = packet.item;
+      packet.sequence.store(2 * (index + this->capacity),
+                            std::memory_order::release);
+    }
+    this->head_index.store(head_index + received, std::memory_order::relaxed);
+    return received;
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
+  bool send_done() const {
+    return this->sender_state.load(std::memory_order::acquire) ==
+           SENDERS_GONE;
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire) != 0;
+  }
+
+  void acquire_sender() {
+    this->sender_state.fetch_add(1, std::memory_order::relaxed);
+  }
+
+  void release_sender() {
+    auto state = this->sender_state.load(std::memory_order::relaxed);
+    while (!this->sender_state.compare_exchange_weak(
+        state, state == 1 ? SENDERS_GONE : state - 1,
+        std::memory_order::acq_rel, std::memory_order::relaxed)) {
+    }
+    if (state == 1) {
+      this->recv_ready.notify_all();
+    }
+  }
+
+  void release_receiver() {
+    this->_recv_done.store(1, std::memory_order::release);
+    this->send_ready.notify_all();
+  }
+};
+} // namespace chan::mpsc::ipc
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _CHAN_MPSC_IPC_PACKET_H
+#define _CHAN_MPSC_IPC_PACKET_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+
+namespace chan::mpsc::ipc {
+/// Item with a sequence number.
+///
+/// A packet is free for the sender that claims position `p` when
+/// `sequence == 2 * p`, and holds an item for the receiver at position `p`
+/// when `sequence == 2 * p + 1`.
+///
+/// There is no reason to work with this class directly.
+template <typename T> struct Packet {
+  alignas(detail::PACKET_ALIGNMENT) alignas(T) T item;
+  std::atomic_size_t sequence;
+};
+} // namespace chan::mpsc::ipc
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef _CHAN_MPSC_IPC_RECEIVER_H
+#define _CHAN_MPSC_IPC_RECEIVER_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "../../RecvIter.hpp"
+#include "../../detail/SharedMemory.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::mpsc::ipc {
+/// Receiving half of a channel between processes.
+///
+/// The `Receiver` owns the name of the shared memory object and removes it
+/// when it disconnects. Threads in other processes can't be woken through a
+/// `Select` or coroutine waker, so there is no `async_recv` and `Select` can't
+/// receive from it.
+///
+/// # Template parameters
+/// `T` - Channel's item type, which must be trivially copyable
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+///
+/// # Safety
+/// Do not share a `Receiver` between threads.
+template <typename T, typename W = wait::Park> class Receiver {
+public:
+  using Item = T;
+
+private:
+  std::shared_ptr<detail::SharedMemory> memory;
+  Chan<T, W> *channel;
+  std::string name;
+
+public:
+  /// Create the `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `create_receiver` function.
+  Receiver(std::shared_ptr<detail::SharedMemory> memory, Chan<T, W> *channel,
+           std::string name)
+      : memory(std::move(memory)), channel(channel), name(std::move(name)) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : memory(), channel(nullptr), name() {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : memory(std::move(other.memory)), channel(other.channel),
+        name(std::move(other.name)) {
+    other.channel = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->memory = std::move(other.memory);
+      this->channel = other.channel;
+      this->name = std::move(other.name);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Receiver(const Receiver &) = delete;
+  Receiver &operator=(const Receiver &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Receive an item from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->recv();
+  }
+
+  /// Receive an item from the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv();
+  }
+
+  /// Receive an item from the channel with a timeout.
+  ///
+  /// Blocks until the channel is not empty, the timeout is met, or all senders
+  /// disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_for(timeout);
+  }
+
+  /// Receive an item from the channel with a deadline.
+  ///
+  /// Blocks until the channel is not empty, the deadline is met, or all senders
+  /// disconnect.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_until(deadline);
+  }
+
+  /// Receive up to `items.size()` items from the channel.
+  ///
+  /// Blocks until the channel is not empty or all senders disconnect. Then
+  /// takes as many items as are available, up to `items.size()`, in a single
+  /// step.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, RecvError> recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->recv_n(items.begin(), items.size());
+  }
+
+  /// Receive up to `items.size()` items from the channel without blocking.
+  ///
+  /// Returns the number of items received. They are move-assigned to the front
+  /// of `items`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::size_t, TryRecvError>
+  try_recv_many(std::span<T> items) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(items.begin(), items.size());
+  }
+
+  /// Move up to `limit` items from the channel to `out` without blocking.
+  ///
+  /// Returns the number of items received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::weakly_incrementable O>
+    requires std::indirectly_writable<O, T>
+  std::expected<std::size_t, TryRecvError>
+  drain_into(O out, std::size_t limit =
+                        std::numeric_limits<std::size_t>::max()) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_n(std::move(out), limit);
+  }
+
+  /// Number of items in the channel.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a receive operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Number of items the channel has space for.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel and remove its name.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel) {
+      this->channel->release_receiver();
+      detail::SharedMemory::unlink(this->name);
+      this->memory.reset();
+    }
+  }
+
+public:
+  RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::mpsc::ipc
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _CHAN_MPSC_OVERWRITING_PACKET_H
+#define _CHAN_MPSC_OVERWRITING_PACKET_H
+
+#include <atomic>
+#include <cstddef>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+
+namespace chan::mpsc::overwriting {
+/// Item with a sequence number.
+///
+/// A packet is free for the sender of position `p` when `sequence == 2 * p`,
+/// and holds that sender's item when `sequence == 2 * p + 1`.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T> struct Packet {
+  alignas(detail::PACKET_ALIGNMENT) alignas(T) T item;
+  std::atomic_size_t sequence;
+};
+} // namespace chan::mpsc::overwriting
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef _CHAN_MPSC_OVERWRITING_SENDER_H
+#define _CHAN_MPSC_OVERWRITING_SENDER_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::mpsc::overwriting {
+/// Sending half of a channel.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's item buffer
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Sender` between threads. If multiple threads need to
+/// send to the same channel, give each thread a its own `Sender` copy.
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<Packet<T>>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+class Sender {
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Sender(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Sender`.
+  Sender() : channel(nullptr), allocator() {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &other)
+      : channel(other.channel), allocator(other.allocator) {
+    this->acquire();
+  }
+
+  Sender &operator=(const Sender &other) {
+    this->release();
+    this->channel = other.channel;
+    this->allocator = other.allocator;
+    this->acquire();
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Send an item on the channel.
+  ///
+  /// Does not block. If the channel is full, the oldest item is dropped to make
+  /// room.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, SendError<T>> send(T item) const {
+    assert(this->channel != nullptr);
+    return this->channel->send(std::move(item));
+  }
+
+  /// Send an item on the channel in a coroutine.
+  ///
+  /// Sending never blocks, so `co_await tx.async_send(item, executor)` never
+  /// suspends the coroutine and does not use `executor`. It returns what
+  /// `send(item)` would have returned.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename E> auto async_send(T item, E) const {
+    return detail::ReadyAwaiter(this->send(std::move(item)));
+  }
+
+  /// Send every item in a range on the channel.
+  ///
+  /// Items are moved out of the range. Does not block. Positions for all of
+  /// the items are reserved at once, and the oldest items are dropped as
+  /// needed to make room. If there are more items than the channel's capacity,
+  /// the first ones are dropped as well.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
+  /// Number of items in the channel.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Maximum number of items the channel holds before dropping the oldest.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire() {
+    if (this->channel) {
+      this->channel->acquire_sender();
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_sender()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+public:
+  SendIter<Sender> begin() const { return SendIter(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::mpsc::overwriting
+
+#endif
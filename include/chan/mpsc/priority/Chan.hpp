@@ -0,0 +1,74 @@
+#ifndef _CHAN_MPSC_PRIORITY_CHANNEL_H
+#define _CHAN_MPSC_PRIORITY_CHANNEL_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+#include "../../detail/PriorityChannel.hpp"
+
+namespace chan::mpsc::priority {
+/// Channel implementation.
+///
+/// See `detail::PriorityChannel` for how items are queued by priority.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T, std::size_t LEVELS, typename W, typename A>
+class Chan : detail::PriorityChannel<Chan<T, LEVELS, W, A>, T, LEVELS, A> {
+  friend struct detail::PriorityChannel<Chan, T, LEVELS, A>;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Sender;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Receiver;
+
+  std::mutex mutex;
+  std::array<std::deque<T, A>, LEVELS> queues;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t item_count;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
+  std::atomic_bool _recv_done;
+  std::atomic_bool disconnected;
+
+public:
+  /// Create a channel that assumes a single `Sender` and single `Receiver`.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(A allocator)
+      : queues(Chan::make_queues(allocator)), item_count(0), sender_count(1),
+        _recv_done(false), disconnected(false) {}
+
+private:
+  bool send_done() const {
+    return this->sender_count.load(std::memory_order::acquire) == 0;
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire);
+  }
+
+  void acquire_sender() {
+    this->sender_count.fetch_add(1, std::memory_order::relaxed);
+  }
+
+  bool release_sender() {
+    if (this->sender_count.fetch_sub(1, std::memory_order::acq_rel) != 1) {
+      return false;
+    }
+    this->recv_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver() {
+    this->_recv_done.store(true, std::memory_order::release);
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::mpsc::priority
+
+#endif
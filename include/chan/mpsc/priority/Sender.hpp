@@ -0,0 +1,201 @@
+#ifndef _CHAN_MPSC_PRIORITY_SENDER_H
+#define _CHAN_MPSC_PRIORITY_SENDER_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::mpsc::priority {
+/// Sending half of a channel.
+///
+/// Every item is sent with a priority from `0` (the default, and the lowest)
+/// to `LEVELS - 1` (the highest).
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `LEVELS` - Number of priorities
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's item queues
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Sender` between threads. If multiple threads need to
+/// send to the same channel, give each thread a its own `Sender` copy.
+template <typename T, std::size_t LEVELS, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, LEVELS, W, A1>>>
+class Sender {
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Sender(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Sender`.
+  Sender() : channel(nullptr), allocator() {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &other)
+      : channel(other.channel), allocator(other.allocator) {
+    this->acquire();
+  }
+
+  Sender &operator=(const Sender &other) {
+    this->release();
+    this->channel = other.channel;
+    this->allocator = other.allocator;
+    this->acquire();
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Send an item on the channel with a priority.
+  ///
+  /// Does not block. The item is received after every item of a higher
+  /// priority and after the items of the same priority sent before it.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or `priority` is not
+  /// less than `LEVELS`.
+  std::expected<void, SendError<T>> send(T item,
+                                         std::size_t priority = 0) const {
+    assert(this->channel != nullptr);
+    return this->channel->send(std::move(item), priority);
+  }
+
+  /// Send an item on the channel with a priority in a coroutine.
+  ///
+  /// Sending never blocks, so `co_await tx.async_send(item, executor)` never
+  /// suspends the coroutine and does not use `executor`. It returns what
+  /// `send(item, priority)` would have returned.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or `priority` is not
+  /// less than `LEVELS`.
+  template <typename E>
+  auto async_send(T item, E, std::size_t priority = 0) const {
+    return detail::ReadyAwaiter(this->send(std::move(item), priority));
+  }
+
+  /// Send every item in a range on the channel with the same priority.
+  ///
+  /// Items are moved out of the range. Does not block.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or `priority` is not
+  /// less than `LEVELS`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items, std::size_t priority = 0) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this, priority](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n, priority);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel with the same
+  /// priority.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true` or `priority` is not
+  /// less than `LEVELS`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n,
+                            std::size_t priority = 0) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n, priority);
+  }
+
+  /// Number of items in the channel, across all priorities.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire() {
+    if (this->channel) {
+      this->channel->acquire_sender();
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_sender()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+public:
+  SendIter<Sender> begin() const { return SendIter(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::mpsc::priority
+
+#endif
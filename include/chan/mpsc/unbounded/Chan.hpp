@@ -1,45 +1,82 @@
 #ifndef _CHAN_MPSC_UNBOUNDED_CHANNEL_H
 #define _CHAN_MPSC_UNBOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <expected>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <thread>
+#include <utility>
 
+#include "../../DEFAULT_MAX_CHUNKS_PER_ALLOCATION.hpp"
+#include "../../RecvView.hpp"
 #include "../../SendError.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../SendSlot.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/Semaphore.hpp"
 #include "../../detail/UnboundedChannel.hpp"
+#include "../../detail/backoff.hpp"
 #include "PacketChunk.hpp"
 
 namespace chan::mpsc::unbounded {
 /// Channel implementation.
 ///
+/// The chunks form a ring. Senders claim packets by advancing `tail_position`
+/// with a compare-exchange, so they never take a lock. A position is split
+/// into a chunk lap and an index within the chunk, with one extra index per
+/// lap, `CHUNK_SIZE`, meaning the sender that claimed the last packet of the
+/// tail chunk is moving the tail to the next chunk. Other senders back off
+/// until it is done. The next chunk is reused if the receiver is finished
+/// with it, or a batch of new chunks as large as the ring, up to
+/// `max_batch_size`, is linked into the ring otherwise. A batch is
+/// deallocated once all of its chunks have been freed. Idle chunks beyond
+/// `idle_chunk_limit` are freed at the same time. `chunk_mutex` serializes
+/// changes to the ring between that sender and `shrink_to_fit`.
+///
+/// A reserved packet that is abandoned is published without an item and is
+/// not counted in `size`. The receiver moves past it on its way to the next
+/// item.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, std::size_t CHUNK_SIZE, typename A>
+template <typename T, std::size_t CHUNK_SIZE, typename W, typename A>
   requires(CHUNK_SIZE != 0)
-class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, A>, T> {
+class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, W, A>, T> {
   friend struct detail::UnboundedChannel<Chan, T>;
-  template <typename, std::size_t, typename, typename> friend class Sender;
-  template <typename, std::size_t, typename, typename> friend class Receiver;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Sender;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Receiver;
+  template <typename, typename> friend class chan::SendSlot;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = Packet<T> *;
+
+  static constexpr std::size_t LAP = CHUNK_SIZE + 1;
 
   A allocator;
 
-  PacketChunk<T, CHUNK_SIZE> *tail_chunk;
-  std::size_t tail_index;
-  std::mutex tail_position_mutex;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_position;
+  std::atomic<PacketChunk<T, CHUNK_SIZE> *> tail_chunk;
+  std::mutex chunk_mutex;
 
-  PacketChunk<T, CHUNK_SIZE> *head_chunk;
+  alignas(detail::CACHE_LINE_SIZE)
+      std::atomic<PacketChunk<T, CHUNK_SIZE> *> head_chunk;
   std::size_t head_index;
 
-  std::atomic_size_t size;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t size;
   std::atomic_size_t capacity;
+  std::atomic_size_t idle_chunk_limit;
+  std::atomic_size_t max_batch_size;
 
-  detail::SemaphoreType recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> recv_ready;
 
-  std::atomic_size_t sender_count;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t sender_count;
   std::atomic_bool disconnected;
 
 public:
@@ -48,24 +85,32 @@ public:
   /// This constructor should not be called directly. Instead, call the
   /// `channel` function.
   Chan(A allocator)
-      : allocator(std::move(allocator)),
+      : allocator(std::move(allocator)), tail_position(0),
         tail_chunk(std::allocator_traits<A>::allocate(this->allocator, 1)),
-        tail_index(0), head_chunk(this->tail_chunk), head_index(0), size(0),
-        capacity(CHUNK_SIZE), recv_ready(0), sender_count(1),
-        disconnected(false) {
-    for (auto &packet : this->tail_chunk->packets) {
-      std::allocator_traits<A>::construct(this->allocator, &packet.read_ready,
-                                          false);
-    }
-    this->tail_chunk->next = this->tail_chunk;
+        head_chunk(this->tail_chunk.load(std::memory_order::relaxed)),
+        head_index(0), size(0), capacity(CHUNK_SIZE),
+        idle_chunk_limit(std::numeric_limits<std::size_t>::max()),
+        max_batch_size(DEFAULT_MAX_CHUNKS_PER_ALLOCATION), recv_ready(0),
+        sender_count(1), disconnected(false) {
+    auto chunk = this->tail_chunk.load(std::memory_order::relaxed);
+    this->construct_flags(chunk);
+    chunk->next = chunk;
+    chunk->batch = chunk;
+    chunk->batch_size = 1;
+    chunk->freed_count = 0;
   }
 
   ~Chan() {
-    auto chunk = this->head_chunk;
+    auto chunk = this->head_chunk.load(std::memory_order::relaxed);
     auto index = this->head_index;
-    while (chunk != this->tail_chunk || index != this->tail_index) {
-      std::allocator_traits<A>::destroy(this->allocator,
-                                        &chunk->packets[index].item);
+    auto tail_chunk = this->tail_chunk.load(std::memory_order::relaxed);
+    auto tail_index =
+        this->tail_position.load(std::memory_order::relaxed) % LAP;
+    while (chunk != tail_chunk || index != tail_index) {
+      if (!chunk->packets[index].abandoned) {
+        std::allocator_traits<A>::destroy(this->allocator,
+                                          &chunk->packets[index].item);
+      }
       if (++index == CHUNK_SIZE) {
         index = 0;
         chunk = chunk->next;
@@ -73,16 +118,10 @@ public:
     }
 
     auto c = chunk->next;
-    for (auto &packet : chunk->packets) {
-      std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
-    }
-    std::allocator_traits<A>::deallocate(this->allocator, chunk, 1);
+    this->free_chunk(chunk);
     while (c != chunk) {
       auto next = c->next;
-      for (auto &packet : c->packets) {
-        std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
-      }
-      std::allocator_traits<A>::deallocate(this->allocator, c, 1);
+      this->free_chunk(c);
       c = next;
     }
   }
@@ -92,57 +131,267 @@ private:
     if (this->disconnected.load(std::memory_order::relaxed)) {
       return std::unexpected(SendError{std::move(item)});
     }
-    Packet<T> *packet;
-    {
-      std::lock_guard _lock(this->tail_position_mutex);
-      auto size = this->size.fetch_add(1, std::memory_order::acquire);
-      packet = &this->tail_chunk->packets[this->tail_index];
-      if (this->tail_index != CHUNK_SIZE - 1) {
-        ++this->tail_index;
-      } else {
-        this->tail_index = 0;
-        if (size <
-            this->capacity.load(std::memory_order::relaxed) - CHUNK_SIZE) {
-          this->tail_chunk = this->tail_chunk->next;
-        } else {
-          auto new_chunk =
-              std::allocator_traits<A>::allocate(this->allocator, 1);
-          for (auto &packet : new_chunk->packets) {
-            std::allocator_traits<A>::construct(this->allocator,
-                                                &packet.read_ready, false);
-          }
-          new_chunk->next = this->tail_chunk->next;
-          this->tail_chunk->next = new_chunk;
-          this->tail_chunk = new_chunk;
-          this->capacity.fetch_add(CHUNK_SIZE, std::memory_order::relaxed);
-        }
+    PacketChunk<T, CHUNK_SIZE> *chunk;
+    std::size_t index;
+    this->claim_tail(chunk, index, 1);
+    this->size.fetch_add(1, std::memory_order::relaxed);
+    auto &packet = chunk->packets[index];
+    std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                        std::move(item));
+    packet.read_ready.store(true, std::memory_order::release);
+    this->recv_ready.release();
+    return {};
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    if (this->disconnected.load(std::memory_order::relaxed)) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    for (std::size_t count = 0; count != n;) {
+      PacketChunk<T, CHUNK_SIZE> *chunk;
+      std::size_t index;
+      auto claimed = this->claim_tail(chunk, index, n - count);
+      this->size.fetch_add(claimed, std::memory_order::relaxed);
+      for (auto end = index + claimed; index != end; ++index, ++first) {
+        auto &packet = chunk->packets[index];
+        std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                            std::ranges::iter_move(first));
+        packet.read_ready.store(true, std::memory_order::release);
       }
+      count += claimed;
     }
+    this->recv_ready.release(static_cast<std::ptrdiff_t>(n));
+    return {std::move(first), n, false};
+  }
+
+  std::expected<Packet<T> *, SendError<void>> reserve() {
+    if (this->disconnected.load(std::memory_order::relaxed)) {
+      return std::unexpected(SendError<void>{});
+    }
+    PacketChunk<T, CHUNK_SIZE> *chunk;
+    std::size_t index;
+    this->claim_tail(chunk, index, 1);
+    return chunk->packets + index;
+  }
+
+  template <typename... Args>
+  void construct_slot(Packet<T> *packet, Args &&...args) {
     std::allocator_traits<A>::construct(this->allocator, &packet->item,
-                                        std::move(item));
+                                        std::forward<Args>(args)...);
+  }
+
+  void commit_slot(Packet<T> *packet) {
+    this->size.fetch_add(1, std::memory_order::relaxed);
     packet->read_ready.store(true, std::memory_order::release);
     this->recv_ready.release();
-    return {};
+  }
+
+  void abandon_slot(Packet<T> *packet) {
+    // The packet already has its place in the order the receiver reads
+    // packets, so it is published without an item for the receiver to skip.
+    packet->abandoned = true;
+    packet->read_ready.store(true, std::memory_order::release);
+  }
+
+  /// Claim between 1 and `n` packets in a row at the tail, all in the same
+  /// chunk.
+  ///
+  /// Sets `chunk` and `index` to the first claimed packet and returns the
+  /// number of packets claimed.
+  std::size_t claim_tail(PacketChunk<T, CHUNK_SIZE> *&chunk, std::size_t &index,
+                         std::size_t n) {
+    auto position = this->tail_position.load(std::memory_order::acquire);
+    for (std::size_t iteration = 0;; ++iteration) {
+      index = position % LAP;
+      if (index == CHUNK_SIZE) {
+        // Another sender is moving the tail to the next chunk.
+        detail::backoff<W>(iteration);
+        position = this->tail_position.load(std::memory_order::acquire);
+        continue;
+      }
+      // The tail chunk only changes while the position is at the end of a
+      // lap, so it matches `position` if the compare-exchange succeeds.
+      chunk = this->tail_chunk.load(std::memory_order::acquire);
+      auto claimed = std::min(n, CHUNK_SIZE - index);
+      if (this->tail_position.compare_exchange_weak(
+              position, position + claimed, std::memory_order::acq_rel,
+              std::memory_order::acquire)) {
+        if (index + claimed == CHUNK_SIZE) {
+          this->advance_tail_chunk(chunk);
+          this->tail_position.store(position + claimed + 1,
+                                    std::memory_order::release);
+        }
+        return claimed;
+      }
+    }
+  }
+
+  /// Move the tail to the chunk that follows `chunk`, the current tail chunk,
+  /// linking new ones into the ring if the receiver is still using the next
+  /// one.
+  ///
+  /// Only called by the sender that claimed the last packet of `chunk`.
+  void advance_tail_chunk(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    std::lock_guard _lock(this->chunk_mutex);
+    auto next = chunk->next;
+    if (next == this->head_chunk.load(std::memory_order::acquire)) {
+      next = this->allocate_batch(chunk);
+    }
+    this->tail_chunk.store(next, std::memory_order::release);
+    this->free_idle_chunks(
+        this->idle_chunk_limit.load(std::memory_order::relaxed));
+  }
+
+  /// Link a batch of new chunks into the ring after `chunk` and return the
+  /// first one.
+  ///
+  /// The batch has as many chunks as the ring, but no more than
+  /// `max_batch_size` or `idle_chunk_limit`.
+  ///
+  /// Call while holding `chunk_mutex`.
+  PacketChunk<T, CHUNK_SIZE> *
+  allocate_batch(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    auto batch_size = std::max<std::size_t>(
+        std::min({this->capacity.load(std::memory_order::relaxed) / CHUNK_SIZE,
+                  this->max_batch_size.load(std::memory_order::relaxed),
+                  this->idle_chunk_limit.load(std::memory_order::relaxed)}),
+        1);
+    auto batch =
+        std::allocator_traits<A>::allocate(this->allocator, batch_size);
+    for (std::size_t offset = 0; offset < batch_size; ++offset) {
+      this->construct_flags(batch + offset);
+      batch[offset].next = batch + offset + 1;
+      batch[offset].batch = batch;
+    }
+    batch->batch_size = batch_size;
+    batch->freed_count = 0;
+    batch[batch_size - 1].next = chunk->next;
+    chunk->next = batch;
+    this->capacity.fetch_add(batch_size * CHUNK_SIZE,
+                             std::memory_order::relaxed);
+    return batch;
+  }
+
+  /// Free the idle chunks after the tail chunk, except for the first `keep`.
+  ///
+  /// Call while holding `chunk_mutex`.
+  void free_idle_chunks(std::size_t keep) {
+    // The receiver only moves `head_chunk` forward after it has emptied the
+    // chunk it leaves, so every chunk between the tail and head is idle. A
+    // stale head is further back and only makes this keep more chunks.
+    auto head_chunk = this->head_chunk.load(std::memory_order::acquire);
+    auto chunk = this->tail_chunk.load(std::memory_order::relaxed);
+    for (; keep != 0 && chunk->next != head_chunk; --keep) {
+      chunk = chunk->next;
+    }
+    while (chunk->next != head_chunk) {
+      auto idle_chunk = chunk->next;
+      chunk->next = idle_chunk->next;
+      this->free_chunk(idle_chunk);
+      this->capacity.fetch_sub(CHUNK_SIZE, std::memory_order::relaxed);
+    }
+  }
+
+  void shrink_to_fit() {
+    std::lock_guard _lock(this->chunk_mutex);
+    this->free_idle_chunks(0);
+  }
+
+  void construct_flags(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    for (auto &packet : chunk->packets) {
+      std::allocator_traits<A>::construct(this->allocator, &packet.read_ready,
+                                          false);
+      std::allocator_traits<A>::construct(this->allocator, &packet.abandoned,
+                                          false);
+    }
+  }
+
+  /// Free `chunk`, and deallocate the chunks it was allocated with once they
+  /// have all been freed.
+  void free_chunk(PacketChunk<T, CHUNK_SIZE> *chunk) {
+    for (auto &packet : chunk->packets) {
+      std::allocator_traits<A>::destroy(this->allocator, &packet.read_ready);
+      std::allocator_traits<A>::destroy(this->allocator, &packet.abandoned);
+    }
+    auto batch = chunk->batch;
+    if (++batch->freed_count == batch->batch_size) {
+      std::allocator_traits<A>::deallocate(this->allocator, batch,
+                                           batch->batch_size);
+    }
   }
 
   std::optional<T> do_recv() {
     if (this->size.load(std::memory_order::relaxed) == 0) {
       return {};
     }
-    auto &packet = this->head_chunk->packets[this->head_index];
-    while (!packet.read_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
-    }
+    auto &packet = this->wait_head_item();
     auto item = std::move(packet.item);
     std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+    this->advance_head();
+    this->size.fetch_sub(1, std::memory_order::release);
+    return item;
+  }
+
+  template <typename O> std::size_t do_recv_n(O &out, std::size_t n) {
+    n = std::min(n, this->size.load(std::memory_order::relaxed));
+    for (std::size_t count = 0; count < n; ++count, ++out) {
+      auto &packet = this->wait_head_item();
+      *out = std::move(packet.item);
+      std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+      this->advance_head();
+    }
+    this->size.fetch_sub(n, std::memory_order::release);
+    return n;
+  }
+
+  std::optional<Packet<T> *> do_peek() {
+    if (this->size.load(std::memory_order::relaxed) == 0) {
+      return {};
+    }
+    return &this->wait_head_item();
+  }
+
+  /// Wait for the packet at the head to be published, moving past abandoned
+  /// packets until one has an item. Call only if `size` is not 0.
+  Packet<T> &wait_head_item() {
+    while (true) {
+      auto &packet = this->head_chunk.load(std::memory_order::relaxed)
+                         ->packets[this->head_index];
+      for (std::size_t iteration = 0;
+           !packet.read_ready.exchange(false, std::memory_order::acquire);
+           ++iteration) {
+        detail::backoff<W>(iteration);
+      }
+      if (!packet.abandoned) {
+        return packet;
+      }
+      packet.abandoned = false;
+      this->advance_head();
+    }
+  }
+
+  void release_slot(Packet<T> *packet) {
+    std::allocator_traits<A>::destroy(this->allocator, &packet->item);
+    this->advance_head();
+    this->size.fetch_sub(1, std::memory_order::release);
+  }
+
+  static T *slot_item(Packet<T> *packet) { return &packet->item; }
+
+  /// Move past the packet that was just received. Publishes the new head
+  /// chunk only after the old one is empty, so senders may reuse or free it.
+  void advance_head() {
     if (this->head_index != CHUNK_SIZE - 1) {
       ++this->head_index;
     } else {
       this->head_index = 0;
-      this->head_chunk = this->head_chunk->next;
+      this->head_chunk.store(
+          this->head_chunk.load(std::memory_order::relaxed)->next,
+          std::memory_order::release);
     }
-    this->size.fetch_sub(1, std::memory_order::release);
-    return item;
   }
 
   bool send_done() const {
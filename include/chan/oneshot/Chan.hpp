@@ -0,0 +1,190 @@
+#ifndef _CHAN_ONESHOT_CHANNEL_H
+#define _CHAN_ONESHOT_CHANNEL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../TryRecvError.hpp"
+#include "../detail/WakeAllEvent.hpp"
+
+namespace chan::oneshot {
+/// Channel implementation.
+///
+/// The item is stored in the channel object itself, so creating a channel
+/// takes a single allocation. Everything the two sides need to agree on lives
+/// in `state`:
+///
+/// - `SENT` - `item` holds the item.
+/// - `SENDER_DONE` - No item will arrive after the one in `item`, if any.
+/// - `SENDER_GONE` - The sender will not touch the channel again.
+/// - `RECEIVER_GONE` - The receiver will not touch the channel again.
+/// - `PARKED` - The receiver is asleep on `state`, which is a futex on Linux.
+///
+/// The sender finishes notifying the receiver before it sets `SENDER_GONE`,
+/// since the receiver could destroy the channel as soon as it sees the item.
+/// Whichever side sets its `_GONE` bit second destroys the channel.
+///
+/// A blocking `recv` sleeps on `state` with `std::atomic::wait`. Timed
+/// receives, `Select` calls and suspended coroutines use `recv_ready` instead,
+/// which costs nothing until one of them is waiting.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T, typename W> class Chan {
+  template <typename, typename, typename> friend class Sender;
+  template <typename, typename, typename> friend class Receiver;
+
+  static constexpr std::uint32_t SENT = 1;
+  static constexpr std::uint32_t SENDER_DONE = 2;
+  static constexpr std::uint32_t SENDER_GONE = 4;
+  static constexpr std::uint32_t RECEIVER_GONE = 8;
+  static constexpr std::uint32_t PARKED = 16;
+
+  std::atomic_uint32_t state;
+  union {
+    T item;
+  };
+  detail::WakeAllEvent<W> recv_ready;
+
+public:
+  /// Create an empty channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan() : state(0) {}
+
+  ~Chan() {
+    if (this->state.load(std::memory_order::relaxed) & SENT) {
+      std::destroy_at(&this->item);
+    }
+  }
+
+private:
+  std::expected<void, SendError<T>> send(T item) {
+    if (this->state.load(std::memory_order::acquire) & RECEIVER_GONE) {
+      return std::unexpected(SendError{std::move(item)});
+    }
+    std::construct_at(&this->item, std::move(item));
+    auto state =
+        this->state.fetch_or(SENT | SENDER_DONE, std::memory_order::acq_rel);
+    if (state & RECEIVER_GONE) {
+      // The receiver left while the item was being stored, so take it back.
+      SendError error{std::move(this->item)};
+      std::destroy_at(&this->item);
+      this->state.fetch_and(~SENT, std::memory_order::relaxed);
+      return std::unexpected(std::move(error));
+    }
+    this->notify(state);
+    return {};
+  }
+
+  std::expected<T, RecvError> recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    for (std::size_t iteration = 0; !this->try_recv_once(item, disconnected);
+         ++iteration) {
+      if (W::pause(iteration)) {
+        continue;
+      }
+      auto state = this->state.load(std::memory_order::relaxed);
+      if (state & SENDER_DONE) {
+        continue;
+      }
+      if ((state & PARKED) ||
+          this->state.compare_exchange_weak(state, state | PARKED,
+                                            std::memory_order::relaxed)) {
+        this->state.wait(state | PARKED, std::memory_order::acquire);
+      }
+    }
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return std::move(*item);
+  }
+
+  std::expected<T, TryRecvError> try_recv() {
+    std::optional<T> item;
+    auto disconnected = false;
+    this->try_recv_once(item, disconnected);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) {
+    return this->try_recv_until(std::chrono::steady_clock::now() + timeout);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError>
+  try_recv_until(const std::chrono::time_point<Clock, Duration> &deadline) {
+    std::optional<T> item;
+    auto disconnected = false;
+    this->recv_ready.wait_until(
+        [&] { return this->try_recv_once(item, disconnected); }, deadline);
+    return this->try_recv_impl(item, disconnected);
+  }
+
+  /// Returns `true` when the operation is finished, either because the item
+  /// was received or because the sender disconnected without sending one.
+  bool try_recv_once(std::optional<T> &item, bool &disconnected) {
+    auto state = this->state.load(std::memory_order::acquire);
+    if (state & SENT) {
+      item.emplace(std::move(this->item));
+      std::destroy_at(&this->item);
+      this->state.fetch_and(~SENT, std::memory_order::relaxed);
+      return true;
+    }
+    if (state & SENDER_DONE) {
+      disconnected = true;
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<T, TryRecvError> try_recv_impl(std::optional<T> &item,
+                                               bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!item) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return std::move(*item);
+  }
+
+  /// Wake the receiver after setting `SENDER_DONE`. `state` is the value from
+  /// before that.
+  void notify(std::uint32_t state) {
+    if (state & PARKED) {
+      this->state.notify_one();
+    }
+    this->recv_ready.notify_all();
+  }
+
+  bool release_sender() {
+    // Only the sender sets `SENDER_DONE`.
+    if (!(this->state.load(std::memory_order::relaxed) & SENDER_DONE)) {
+      this->notify(
+          this->state.fetch_or(SENDER_DONE, std::memory_order::acq_rel));
+    }
+    return this->state.fetch_or(SENDER_GONE, std::memory_order::acq_rel) &
+           RECEIVER_GONE;
+  }
+
+  bool release_receiver() {
+    return this->state.fetch_or(RECEIVER_GONE, std::memory_order::acq_rel) &
+           SENDER_GONE;
+  }
+};
+} // namespace chan::oneshot
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef _CHAN_ONESHOT_RECEIVER_H
+#define _CHAN_ONESHOT_RECEIVER_H
+
+#include <cassert>
+#include <memory>
+#include <utility>
+
+#include "../Select.hpp"
+#include "../detail/Awaiter.hpp"
+#include "../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::oneshot {
+/// Receiving half of a channel.
+///
+/// Once the item has been received, receiving fails as if the sender had
+/// disconnected.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Receiver` between threads.
+template <typename T, typename W = wait::Park,
+          typename A = std::allocator<Chan<T, W>>>
+class Receiver {
+  friend class chan::Select;
+
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A>::pointer channel;
+  A allocator;
+
+public:
+  /// Create the `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Receiver(std::allocator_traits<A>::pointer channel, A allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : channel(nullptr), allocator() {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Receiver(const Receiver &) = delete;
+  Receiver &operator=(const Receiver &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Receive the item from the channel.
+  ///
+  /// Blocks until the item is sent or the sender disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->recv();
+  }
+
+  /// Receive the item from the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<T, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv();
+  }
+
+  /// Receive the item from the channel with a timeout.
+  ///
+  /// Blocks until the item is sent, the timeout is met, or the sender
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<T, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_for(timeout);
+  }
+
+  /// Receive the item from the channel with a deadline.
+  ///
+  /// Blocks until the item is sent, the deadline is met, or the sender
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<T, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_until(deadline);
+  }
+
+  /// Receive the item from the channel in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until the item
+  /// is sent or the sender disconnects, then returns what `recv()` would have
+  /// returned. The coroutine is resumed by a function object that is passed to
+  /// `executor`, which must queue it to run on some thread rather than run it
+  /// right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel && this->channel->release_receiver()) {
+      std::allocator_traits<A>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+  detail::WakerList &wakers() const {
+    return this->channel->recv_ready.wakers();
+  }
+};
+} // namespace chan::oneshot
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef _CHAN_ONESHOT_SENDER_H
+#define _CHAN_ONESHOT_SENDER_H
+
+#include <cassert>
+#include <memory>
+#include <utility>
+
+#include "../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::oneshot {
+/// Sending half of a channel.
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Sender` between threads.
+template <typename T, typename W = wait::Park,
+          typename A = std::allocator<Chan<T, W>>>
+class Sender {
+public:
+  using Item = T;
+
+private:
+  std::allocator_traits<A>::pointer channel;
+  A allocator;
+
+public:
+  /// Create the `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Sender(std::allocator_traits<A>::pointer channel, A allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Sender`.
+  Sender() : channel(nullptr), allocator() {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &) = delete;
+  Sender &operator=(const Sender &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Send the channel's item.
+  ///
+  /// Does not block. Fails if the receiver has disconnected. Either way, `this`
+  /// disconnects from the channel, so `is_null()` will be `true` afterwards.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, SendError<T>> send(T item) {
+    assert(this->channel != nullptr);
+    auto result = this->channel->send(std::move(item));
+    this->disconnect();
+    return result;
+  }
+
+  /// Disconnect from the channel without sending an item.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel && this->channel->release_sender()) {
+      std::allocator_traits<A>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+};
+} // namespace chan::oneshot
+
+#endif
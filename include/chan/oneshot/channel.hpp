@@ -0,0 +1,33 @@
+#ifndef _CHAN_ONESHOT_CREATE_H
+#define _CHAN_ONESHOT_CREATE_H
+
+#include "../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::oneshot {
+/// Create a new channel for a single item and get a `Sender` and `Receiver`
+/// for it.
+///
+/// The item is stored in the channel object, so this is the only allocation.
+///
+/// # Parameters
+/// `allocator` (optional) - Allocator for the channel object
+///
+/// # Template parameters
+/// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A` (optional) - Type of `allocator` parameter
+template <typename T, typename W = wait::Park,
+          typename A = std::allocator<Chan<T, W>>>
+std::pair<Sender<T, W, A>, Receiver<T, W, A>> channel(A allocator = A()) {
+  auto channel = std::allocator_traits<A>::allocate(allocator, 1);
+  std::allocator_traits<A>::construct(allocator, channel);
+  Sender<T, W, A> sender(channel, allocator);
+  Receiver<T, W, A> receiver(std::move(channel), std::move(allocator));
+  return {std::move(sender), std::move(receiver)};
+}
+} // namespace chan::oneshot
+
+#endif
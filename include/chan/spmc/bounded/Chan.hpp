@@ -2,12 +2,14 @@
 #define _CHAN_SPMC_BOUNDED_CHANNEL_H
 
 #include <atomic>
+#include <iterator>
 #include <memory>
 #include <optional>
-#include <thread>
 
 #include "../../detail/BoundedChannel.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/Semaphore.hpp"
+#include "../../detail/backoff.hpp"
 #include "../Packet.hpp"
 
 namespace chan::spmc::bounded {
@@ -15,21 +17,21 @@ namespace chan::spmc::bounded {
 ///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, typename A>
-class Chan : detail::BoundedChannel<Chan<T, A>, T> {
+template <typename T, typename W, typename A>
+class Chan : detail::BoundedChannel<Chan<T, W, A>, T> {
   friend struct detail::BoundedChannel<Chan, T>;
-  template <typename, typename, typename> friend class Sender;
-  template <typename, typename, typename> friend class Receiver;
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
 
   A allocator;
   std::allocator_traits<A>::pointer packet_buffer;
   std::size_t capacity;
-  std::atomic_size_t head_index;
-  std::size_t tail_index;
-  std::atomic_size_t size;
-  detail::SemaphoreType send_ready;
-  detail::SemaphoreType recv_ready;
-  std::atomic_bool _send_done;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  alignas(detail::CACHE_LINE_SIZE) std::size_t tail_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t size;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_bool _send_done;
   std::atomic_size_t receiver_count;
   std::atomic_bool disconnected;
 
@@ -73,8 +75,10 @@ public:
 private:
   void do_send(T item) {
     auto &packet = this->packet_buffer[this->tail_index];
-    while (!packet.write_ready.exchange(false, std::memory_order::acquire)) {
-      std::this_thread::yield();
+    for (std::size_t iteration = 0;
+         !packet.write_ready.exchange(false, std::memory_order::acquire);
+         ++iteration) {
+      detail::backoff<W>(iteration);
     }
     std::allocator_traits<A>::construct(this->allocator, &packet.item,
                                         std::move(item));
@@ -83,6 +87,23 @@ private:
     }
   }
 
+  template <typename I> I do_send_n(I first, std::size_t n) {
+    for (; n != 0; --n, ++first) {
+      auto &packet = this->packet_buffer[this->tail_index];
+      for (std::size_t iteration = 0;
+           !packet.write_ready.exchange(false, std::memory_order::acquire);
+           ++iteration) {
+        detail::backoff<W>(iteration);
+      }
+      std::allocator_traits<A>::construct(this->allocator, &packet.item,
+                                          std::ranges::iter_move(first));
+      if (++this->tail_index == this->capacity) {
+        this->tail_index = 0;
+      }
+    }
+    return first;
+  }
+
   T do_recv() {
     std::size_t head_index;
     do {
@@ -98,6 +119,25 @@ private:
     return item;
   }
 
+  template <typename O> void do_recv_n(O &out, std::size_t n) {
+    std::size_t head_index;
+    do {
+      head_index = this->head_index.load(std::memory_order::relaxed);
+    } while (!this->head_index.compare_exchange_weak(
+        head_index, (head_index + n) % this->capacity,
+        std::memory_order::relaxed));
+
+    for (; n != 0; --n, ++out) {
+      auto &packet = this->packet_buffer[head_index];
+      *out = std::move(packet.item);
+      std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+      packet.write_ready.store(true, std::memory_order::release);
+      if (++head_index == this->capacity) {
+        head_index = 0;
+      }
+    }
+  }
+
   bool send_done() const {
     return this->_send_done.load(std::memory_order::acquire);
   }
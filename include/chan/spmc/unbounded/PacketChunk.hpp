@@ -12,6 +12,13 @@ namespace chan::spmc::unbounded {
 /// directly.
 template <typename T, std::size_t CHUNK_SIZE> struct PacketChunk {
   PacketChunk *next;
+  /// First of the chunks that were allocated together with this one.
+  PacketChunk *batch;
+  /// Number of chunks allocated together. Only used in the first chunk.
+  std::size_t batch_size;
+  /// Number of chunks allocated together that have been freed. Only used in
+  /// the first chunk.
+  std::size_t freed_count;
   Packet<T> packets[CHUNK_SIZE];
 };
 } // namespace chan::spmc::unbounded
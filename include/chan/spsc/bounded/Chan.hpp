@@ -1,33 +1,58 @@
 #ifndef _CHAN_SPSC_BOUNDED_CHANNEL_H
 #define _CHAN_SPSC_BOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <utility>
 
-#include "../../detail/BoundedChannel.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../RecvView.hpp"
+#include "../../SendSlot.hpp"
+#include "../../detail/BoundedRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
 
 namespace chan::spsc::bounded {
 /// Channel implementation.
 ///
+/// `head_index` and `tail_index` count the items received and sent so far.
+/// Each is written by only one side. That side also keeps the slot its index
+/// points to and a cached copy of the other side's index, and only reloads the
+/// other index when the cached one says the channel is full (for the sender)
+/// or empty (for the receiver). In the steady state, a send or receive touches
+/// no cache line that the other side writes.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, typename A>
-class Chan : detail::BoundedChannel<Chan<T, A>, T> {
-  friend struct detail::BoundedChannel<Chan, T>;
-  template <typename, typename, typename> friend class Sender;
-  template <typename, typename, typename> friend class Receiver;
+template <typename T, typename W, typename A>
+class Chan : detail::BoundedRingChannel<Chan<T, W, A>, T> {
+  friend struct detail::BoundedRingChannel<Chan, T>;
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
+  template <typename, typename> friend class chan::SendSlot;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = T *;
 
   A allocator;
   std::allocator_traits<A>::pointer item_buffer;
   std::size_t capacity;
-  std::size_t head_index;
-  std::size_t tail_index;
-  std::atomic_size_t size;
-  detail::SemaphoreType send_ready;
-  detail::SemaphoreType recv_ready;
-  std::atomic_bool _send_done;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  std::size_t tail_slot;
+  std::size_t cached_head_index;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  std::size_t head_slot;
+  std::size_t cached_tail_index;
+
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_bool _send_done;
   std::atomic_bool _recv_done;
   std::atomic_bool disconnected;
 
@@ -40,17 +65,19 @@ public:
       : allocator(std::move(allocator)),
         item_buffer(
             std::allocator_traits<A>::allocate(this->allocator, capacity)),
-        capacity(capacity), head_index(0), tail_index(0), size(0),
-        send_ready(capacity), recv_ready(0), _send_done(false),
+        capacity(capacity), tail_index(0), tail_slot(0), cached_head_index(0),
+        head_index(0), head_slot(0), cached_tail_index(0), _send_done(false),
         _recv_done(false), disconnected(false) {}
 
   ~Chan() {
-    auto index = this->head_index;
-    while (index != this->tail_index) {
+    auto slot = this->head_slot;
+    auto count = this->tail_index.load(std::memory_order::relaxed) -
+                 this->head_index.load(std::memory_order::relaxed);
+    for (; count != 0; --count) {
       std::allocator_traits<A>::destroy(this->allocator,
-                                        this->item_buffer + index);
-      if (++index == this->capacity) {
-        index = 0;
+                                        this->item_buffer + slot);
+      if (++slot == this->capacity) {
+        slot = 0;
       }
     }
     std::allocator_traits<A>::deallocate(this->allocator, this->item_buffer,
@@ -58,24 +85,147 @@ public:
   }
 
 private:
-  void do_send(T item) {
+  bool try_do_send(T &item) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    if (this->free_slots(tail_index) == 0) {
+      return false;
+    }
     std::allocator_traits<A>::construct(
-        this->allocator, this->item_buffer + this->tail_index, std::move(item));
-    if (++this->tail_index == this->capacity) {
-      this->tail_index = 0;
+        this->allocator, this->item_buffer + this->tail_slot, std::move(item));
+    if (++this->tail_slot == this->capacity) {
+      this->tail_slot = 0;
     }
+    this->tail_index.store(tail_index + 1, std::memory_order::release);
+    return true;
   }
 
-  T do_recv() {
-    auto &chan_item = this->item_buffer[this->head_index];
-    auto item = std::move(chan_item);
+  template <typename I> std::size_t try_do_send_n(I &first, std::size_t n) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    n = std::min(n, this->free_slots(tail_index));
+    for (std::size_t count = 0; count != n; ++count, ++first) {
+      std::allocator_traits<A>::construct(this->allocator,
+                                          this->item_buffer + this->tail_slot,
+                                          std::ranges::iter_move(first));
+      if (++this->tail_slot == this->capacity) {
+        this->tail_slot = 0;
+      }
+    }
+    if (n != 0) {
+      this->tail_index.store(tail_index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  std::optional<T> try_do_recv() {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    if (this->filled_slots(head_index) == 0) {
+      return {};
+    }
+    auto &chan_item = this->item_buffer[this->head_slot];
+    std::optional<T> item(std::move(chan_item));
     std::allocator_traits<A>::destroy(this->allocator, &chan_item);
-    if (++this->head_index == this->capacity) {
-      this->head_index = 0;
+    if (++this->head_slot == this->capacity) {
+      this->head_slot = 0;
     }
+    this->head_index.store(head_index + 1, std::memory_order::release);
     return item;
   }
 
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    n = std::min(n, this->filled_slots(head_index));
+    for (std::size_t count = 0; count != n; ++count, ++out) {
+      auto &chan_item = this->item_buffer[this->head_slot];
+      *out = std::move(chan_item);
+      std::allocator_traits<A>::destroy(this->allocator, &chan_item);
+      if (++this->head_slot == this->capacity) {
+        this->head_slot = 0;
+      }
+    }
+    if (n != 0) {
+      this->head_index.store(head_index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  bool try_do_reserve(T *&slot) {
+    if (this->free_slots(this->tail_index.load(std::memory_order::relaxed)) ==
+        0) {
+      return false;
+    }
+    slot = std::to_address(this->item_buffer + this->tail_slot);
+    return true;
+  }
+
+  template <typename... Args> void construct_slot(T *slot, Args &&...args) {
+    std::allocator_traits<A>::construct(this->allocator, slot,
+                                        std::forward<Args>(args)...);
+  }
+
+  void do_commit_slot(T *) {
+    if (++this->tail_slot == this->capacity) {
+      this->tail_slot = 0;
+    }
+    this->tail_index.store(
+        this->tail_index.load(std::memory_order::relaxed) + 1,
+        std::memory_order::release);
+  }
+
+  /// Nothing was published, so the slot is simply reserved again next time.
+  void abandon_slot(T *) {}
+
+  bool try_do_peek(T *&slot) {
+    if (this->filled_slots(this->head_index.load(std::memory_order::relaxed)) ==
+        0) {
+      return false;
+    }
+    slot = std::to_address(this->item_buffer + this->head_slot);
+    return true;
+  }
+
+  void do_release_slot(T *slot) {
+    std::allocator_traits<A>::destroy(this->allocator, slot);
+    if (++this->head_slot == this->capacity) {
+      this->head_slot = 0;
+    }
+    this->head_index.store(
+        this->head_index.load(std::memory_order::relaxed) + 1,
+        std::memory_order::release);
+  }
+
+  static T *slot_item(T *slot) { return slot; }
+
+  /// Number of slots the sender can fill, reloading `head_index` only when
+  /// the cached copy says the channel is full.
+  std::size_t free_slots(std::size_t tail_index) {
+    auto free = this->capacity - (tail_index - this->cached_head_index);
+    if (free == 0) {
+      this->cached_head_index =
+          this->head_index.load(std::memory_order::acquire);
+      free = this->capacity - (tail_index - this->cached_head_index);
+    }
+    return free;
+  }
+
+  /// Number of slots the receiver can empty, reloading `tail_index` only when
+  /// the cached copy says the channel is empty.
+  std::size_t filled_slots(std::size_t head_index) {
+    auto filled = this->cached_tail_index - head_index;
+    if (filled == 0) {
+      this->cached_tail_index =
+          this->tail_index.load(std::memory_order::acquire);
+      filled = this->cached_tail_index - head_index;
+    }
+    return filled;
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::acquire);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
   bool send_done() const {
     return this->_send_done.load(std::memory_order::acquire);
   }
@@ -86,13 +236,13 @@ private:
 
   bool release_sender() {
     this->_send_done.store(true, std::memory_order::release);
-    this->recv_ready.release();
+    this->recv_ready.notify_all();
     return this->disconnected.exchange(true, std::memory_order::acq_rel);
   }
 
   bool release_receiver() {
     this->_recv_done.store(true, std::memory_order::release);
-    this->send_ready.release();
+    this->send_ready.notify_all();
     return this->disconnected.exchange(true, std::memory_order::acq_rel);
   }
 };
@@ -0,0 +1,193 @@
+#ifndef _CHAN_SPSC_BYTES_CHANNEL_H
+#define _CHAN_SPSC_BYTES_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "../../RecvView.hpp"
+#include "../../detail/ByteRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+
+namespace chan::spsc::bytes {
+/// Channel implementation.
+///
+/// `head_index` and `tail_index` count the bytes received and sent so far,
+/// including padding. As in `spsc::bounded::Chan`, each is written by only
+/// one side, which also keeps the buffer offset its index points to and a
+/// cached copy of the other side's index. Publishing `tail_index` publishes
+/// every header and message before it, so headers are plain memory.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename W, typename A>
+class Chan : detail::ByteRingChannel<Chan<W, A>> {
+  friend struct detail::ByteRingChannel<Chan>;
+  template <typename, typename, typename> friend class Sender;
+  template <typename, typename, typename> friend class Receiver;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = detail::ByteRingChannel<Chan>::Slot;
+
+  A allocator;
+  std::size_t capacity;
+  std::allocator_traits<A>::pointer buffer;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  std::size_t tail_offset;
+  std::size_t cached_head_index;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  std::size_t head_offset;
+  std::size_t cached_tail_index;
+
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_bool _send_done;
+  std::atomic_bool _recv_done;
+  std::atomic_bool disconnected;
+
+public:
+  /// Create a channel that assumes a single `Sender` and single `Receiver`.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(std::size_t capacity, A allocator)
+      : allocator(std::move(allocator)),
+        capacity(this->buffer_size(capacity)),
+        buffer(std::allocator_traits<A>::allocate(this->allocator,
+                                                  this->capacity)),
+        tail_index(0), tail_offset(0), cached_head_index(0), head_index(0),
+        head_offset(0), cached_tail_index(0), _send_done(false),
+        _recv_done(false), disconnected(false) {}
+
+  ~Chan() {
+    std::allocator_traits<A>::deallocate(this->allocator, this->buffer,
+                                         this->capacity);
+  }
+
+private:
+  bool try_do_send(std::span<const std::byte> message) {
+    auto frame_size = this->frame_size(message.size());
+    auto offset = this->tail_offset;
+    auto skipped =
+        frame_size <= this->capacity - offset ? 0 : this->capacity - offset;
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    if (this->free_bytes(tail_index, skipped + frame_size) <
+        skipped + frame_size) {
+      return false;
+    }
+    if (skipped != 0) {
+      this->write_header(offset, this->PADDING);
+      offset = 0;
+    }
+    this->write_header(offset, message.size() + 1);
+    std::ranges::copy(message, this->data() + offset + this->HEADER_SIZE);
+    offset += frame_size;
+    this->tail_offset = offset == this->capacity ? 0 : offset;
+    this->tail_index.store(tail_index + skipped + frame_size,
+                           std::memory_order::release);
+    return true;
+  }
+
+  bool try_do_recv(Slot &slot) {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    if (this->filled_bytes(head_index) == 0) {
+      return false;
+    }
+    auto offset = this->head_offset;
+    std::size_t skipped = 0;
+    auto header = this->read_header(offset);
+    if (header == this->PADDING) {
+      skipped = this->capacity - offset;
+      offset = 0;
+      header = this->read_header(offset);
+    }
+    auto size = header - 1;
+    slot = {{this->data() + offset + this->HEADER_SIZE, size},
+            skipped + this->frame_size(size)};
+    return true;
+  }
+
+  void do_release_slot(const Slot &slot) {
+    this->head_offset += slot.size;
+    if (this->head_offset >= this->capacity) {
+      this->head_offset -= this->capacity;
+    }
+    this->head_index.store(
+        this->head_index.load(std::memory_order::relaxed) + slot.size,
+        std::memory_order::release);
+  }
+
+  std::byte *data() const { return std::to_address(this->buffer); }
+
+  std::size_t read_header(std::size_t offset) const {
+    std::size_t header;
+    std::memcpy(&header, this->data() + offset, sizeof(header));
+    return header;
+  }
+
+  void write_header(std::size_t offset, std::size_t header) {
+    std::memcpy(this->data() + offset, &header, sizeof(header));
+  }
+
+  /// Number of bytes the sender can fill, reloading `head_index` only when the
+  /// cached copy says there are fewer than `needed`.
+  std::size_t free_bytes(std::size_t tail_index, std::size_t needed) {
+    auto free = this->capacity - (tail_index - this->cached_head_index);
+    if (free < needed) {
+      this->cached_head_index =
+          this->head_index.load(std::memory_order::acquire);
+      free = this->capacity - (tail_index - this->cached_head_index);
+    }
+    return free;
+  }
+
+  /// Number of bytes the receiver can empty, reloading `tail_index` only when
+  /// the cached copy says the channel is empty.
+  std::size_t filled_bytes(std::size_t head_index) {
+    auto filled = this->cached_tail_index - head_index;
+    if (filled == 0) {
+      this->cached_tail_index =
+          this->tail_index.load(std::memory_order::acquire);
+      filled = this->cached_tail_index - head_index;
+    }
+    return filled;
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::acquire);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
+  bool send_done() const {
+    return this->_send_done.load(std::memory_order::acquire);
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire);
+  }
+
+  bool release_sender() {
+    this->_send_done.store(true, std::memory_order::release);
+    this->recv_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver() {
+    this->_recv_done.store(true, std::memory_order::release);
+    this->send_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::spsc::bytes
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef _CHAN_SPSC_BYTES_RECEIVER_H
+#define _CHAN_SPSC_BYTES_RECEIVER_H
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "../../RecvError.hpp"
+#include "../../RecvView.hpp"
+#include "../../TryRecvError.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::spsc::bytes {
+/// Receiving half of a channel.
+///
+/// # Template parameters
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's byte buffer
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Receiver` between threads.
+template <typename W = wait::Park, typename A1 = std::allocator<std::byte>,
+          typename A2 = std::allocator<Chan<W, A1>>>
+class Receiver {
+public:
+  /// Handle returned by `recv`. `**message` is the message's bytes in the
+  /// channel's buffer.
+  using Message = RecvView<const std::span<const std::byte>, Chan<W, A1>>;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+
+public:
+  /// Create the initial `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Receiver(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : channel(nullptr), allocator() {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)) {
+    other.channel = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Receiver(const Receiver &) = delete;
+  Receiver &operator=(const Receiver &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Receive a message from the channel.
+  ///
+  /// Blocks until the channel is not empty or the sender disconnects. The
+  /// message is read in place through the returned `RecvView`, and its room
+  /// in the channel is freed when the view is released.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<Message, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->recv();
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return Message(channel, *slot);
+  }
+
+  /// Receive a message from the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  std::expected<Message, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->try_recv();
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return Message(channel, *slot);
+  }
+
+  /// Receive a message from the channel with a timeout.
+  ///
+  /// Blocks until the channel is not empty, the timeout is met, or the sender
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  template <typename Rep, typename Period>
+  std::expected<Message, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->try_recv_for(timeout);
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return Message(channel, *slot);
+  }
+
+  /// Receive a message from the channel with a deadline.
+  ///
+  /// Blocks until the channel is not empty, the deadline is met, or the sender
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `RecvView` for
+  /// what may be done while the view is held.
+  template <typename Clock, typename Duration>
+  std::expected<Message, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->try_recv_until(deadline);
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return Message(channel, *slot);
+  }
+
+  /// Number of bytes that messages in the channel take up, including their
+  /// headers and padding.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Number of bytes the channel has allocated for messages.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel && this->channel->release_receiver()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+};
+} // namespace chan::spsc::bytes
+
+#endif
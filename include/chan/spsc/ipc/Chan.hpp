@@ -0,0 +1,225 @@
+#ifndef _CHAN_SPSC_IPC_CHANNEL_H
+#define _CHAN_SPSC_IPC_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+
+#include "../../detail/BoundedRingChannel.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/SharedEventCount.hpp"
+#include "../../detail/SharedMemory.hpp"
+
+namespace chan::spsc::ipc {
+/// Channel implementation, placed at the start of a shared memory object and
+/// followed by the item buffer.
+///
+/// Uses the same index scheme as `spsc::bounded::Chan`. Nothing in the object
+/// is a pointer, so every process can map it at a different address. Each
+/// index's slot and cached copy of the other index are only touched by the
+/// process on that side.
+///
+/// There is no reason to work with this class directly.
+template <typename T, typename W>
+class Chan : detail::BoundedRingChannel<Chan<T, W>, T> {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "items are copied between processes byte by byte");
+  static_assert(alignof(T) <= detail::CACHE_LINE_SIZE);
+  static_assert(std::atomic_size_t::is_always_lock_free);
+
+  friend struct detail::BoundedRingChannel<Chan, T>;
+  template <typename, typename> friend class Sender;
+  template <typename, typename> friend class Receiver;
+
+  static constexpr std::uint32_t MAGIC = 0x63687331;
+  static constexpr std::uint32_t SENDER_CONNECTED = 1;
+  static constexpr std::uint32_t SENDER_GONE = 2;
+
+  std::atomic_uint32_t magic;
+  std::uint32_t layout_size;
+  std::size_t item_size;
+  std::size_t capacity;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  std::size_t tail_slot;
+  std::size_t cached_head_index;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  std::size_t head_slot;
+  std::size_t cached_tail_index;
+
+  alignas(detail::CACHE_LINE_SIZE) detail::SharedEventCount<W> send_ready;
+  alignas(detail::CACHE_LINE_SIZE) detail::SharedEventCount<W> recv_ready;
+
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_uint32_t sender_state;
+  std::atomic_uint32_t _recv_done;
+
+public:
+  /// Number of bytes of shared memory for a channel of `capacity` items.
+  static std::size_t memory_size(std::size_t capacity) {
+    return sizeof(Chan) + capacity * sizeof(T);
+  }
+
+  /// Construct a channel at the start of `memory`, which must hold at least
+  /// `memory_size(capacity)` bytes.
+  static Chan *create(const detail::SharedMemory &memory,
+                      std::size_t capacity) {
+    auto channel = ::new (memory.data()) Chan(capacity);
+    channel->magic.store(MAGIC, std::memory_order::release);
+    return channel;
+  }
+
+  /// Get the channel that another process constructed in `memory`.
+  ///
+  /// Throws `std::system_error` if `memory` does not hold a channel of this
+  /// type, or one that is not fully constructed yet.
+  static Chan *open(const detail::SharedMemory &memory) {
+    auto channel = static_cast<Chan *>(memory.data());
+    if (memory.size() < sizeof(Chan) ||
+        channel->magic.load(std::memory_order::acquire) != MAGIC ||
+        channel->layout_size != sizeof(Chan) ||
+        channel->item_size != sizeof(T) ||
+        memory.size() < memory_size(channel->capacity)) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "not a chan::spsc::ipc channel of this type");
+    }
+    return channel;
+  }
+
+  /// Claim the sending side.
+  ///
+  /// Returns `false` if a sender has already connected.
+  bool connect_sender() {
+    std::uint32_t state = 0;
+    return this->sender_state.compare_exchange_strong(
+        state, SENDER_CONNECTED, std::memory_order::acquire,
+        std::memory_order::relaxed);
+  }
+
+private:
+  explicit Chan(std::size_t capacity)
+      : layout_size(sizeof(Chan)), item_size(sizeof(T)), capacity(capacity),
+        tail_index(0), tail_slot(0), cached_head_index(0), head_index(0),
+        head_slot(0), cached_tail_index(0), sender_state(0), _recv_done(0) {}
+
+  T *item_buffer() {
+    return reinterpret_cast<T *>(reinterpret_cast<std::byte *>(this) +
+                                 sizeof(Chan));
+  }
+
+  bool try_do_send(T &item) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    if (this->free_slots(tail_index) == 0) {
+      return false;
+    }
+    std::construct_at(this->item_buffer() + this->tail_slot, std::move(item));
+    if (++this->tail_slot == this->capacity) {
+      this->tail_slot = 0;
+    }
+    this->tail_index.store(tail_index + 1, std::memory_order::release);
+    return true;
+  }
+
+  template <typename I> std::size_t try_do_send_n(I &first, std::size_t n) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    n = std::min(n, this->free_slots(tail_index));
+    for (std::size_t count = 0; count != n; ++count, ++first) {
+      std::construct_at(this->item_buffer() + this->tail_slot,
+                        std::ranges::iter_move(first));
+      if (++this->tail_slot == this->capacity) {
+        this->tail_slot = 0;
+      }
+    }
+    if (n != 0) {
+      this->tail_index.store(tail_index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  std::optional<T> try_do_recv() {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    if (this->filled_slots(head_index) == 0) {
+      return {};
+    }
+    std::optional<T> item(this->item_buffer()[this->head_slot]);
+    if (++this->head_slot == this->capacity) {
+      this->head_slot = 0;
+    }
+    this->head_index.store(head_index + 1, std::memory_order::release);
+    return item;
+  }
+
+  template <typename O> std::size_t try_do_recv_n(O &out, std::size_t n) {
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    n = std::min(n, this->filled_slots(head_index));
+    for (std::size_t count = 0; count != n; ++count, ++out) {
+      *out = this->item_buffer()[this->head_slot];
+      if (++this->head_slot == this->capacity) {
+        this->head_slot = 0;
+      }
+    }
+    if (n != 0) {
+      this->head_index.store(head_index + n, std::memory_order::release);
+    }
+    return n;
+  }
+
+  /// Number of slots the sender can fill, reloading `head_index` only when
+  /// the cached copy says the channel is full.
+  std::size_t free_slots(std::size_t tail_index) {
+    auto free = this->capacity - (tail_index - this->cached_head_index);
+    if (free == 0) {
+      this->cached_head_index =
+          this->head_index.load(std::memory_order::acquire);
+      free = this->capacity - (tail_index - this->cached_head_index);
+    }
+    return free;
+  }
+
+  /// Number of slots the receiver can empty, reloading `tail_index` only when
+  /// the cached copy says the channel is empty.
+  std::size_t filled_slots(std::size_t head_index) {
+    auto filled = this->cached_tail_index - head_index;
+    if (filled == 0) {
+      this->cached_tail_index =
+          this->tail_index.load(std::memory_order::acquire);
+      filled = this->cached_tail_index - head_index;
+    }
+    return filled;
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::acquire);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
+  bool send_done() const {
+    return this->sender_state.load(std::memory_order::acquire) == SENDER_GONE;
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire) != 0;
+  }
+
+  void release_sender() {
+    this->sender_state.store(SENDER_GONE, std::memory_order::release);
+    this->recv_ready.notify_all();
+  }
+
+  void release_receiver() {
+    this->_recv_done.store(1, std::memory_order::release);
+    this->send_ready.notify_all();
+  }
+};
+} // namespace chan::spsc::ipc
+
+#endif
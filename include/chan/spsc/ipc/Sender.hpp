@@ -0,0 +1,223 @@
+#ifndef _CHAN_SPSC_IPC_SENDER_H
+#define _CHAN_SPSC_IPC_SENDER_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../detail/SharedMemory.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::spsc::ipc {
+/// Sending half of a channel between processes.
+///
+/// Threads in other processes can't be woken through a `Select` or coroutine
+/// waker, so there is no `async_send` and `Select` can't send on it.
+///
+/// # Template parameters
+/// `T` - Channel's item type, which must be trivially copyable
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+///
+/// # Safety
+/// Do not share a `Sender` between threads. If multiple threads need to
+/// send to the same channel, use mpsc instead of spsc.
+template <typename T, typename W = wait::Park> class Sender {
+public:
+  using Item = T;
+
+private:
+  std::shared_ptr<detail::SharedMemory> memory;
+  Chan<T, W> *channel;
+
+public:
+  /// Create the `Sender` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `connect_sender` function.
+  Sender(std::shared_ptr<detail::SharedMemory> memory, Chan<T, W> *channel)
+      : memory(std::move(memory)), channel(channel) {}
+
+  /// Create a null `Sender`.
+  Sender() : memory(), channel(nullptr) {}
+
+  ~Sender() { this->release(); }
+
+  Sender(Sender &&other)
+      : memory(std::move(other.memory)), channel(other.channel) {
+    other.channel = nullptr;
+  }
+
+  Sender &operator=(Sender &&other) {
+    if (this != &other) {
+      this->release();
+      this->memory = std::move(other.memory);
+      this->channel = other.channel;
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  Sender(const Sender &) = delete;
+  Sender &operator=(const Sender &) = delete;
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Send an item on the channel.
+  ///
+  /// Blocks until the channel is not full or the receiver disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, SendError<T>> send(T item) const {
+    assert(this->channel != nullptr);
+    return this->channel->send(std::move(item));
+  }
+
+  /// Send an item on the channel without blocking.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, TrySendError<T>> try_send(T item) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send(std::move(item));
+  }
+
+  /// Send an item on the channel with a timeout.
+  ///
+  /// Blocks until the channel is not full, the timeout is met, or the receiver
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<void, TrySendError<T>>
+  try_send_for(T item,
+               const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_for(std::move(item), timeout);
+  }
+
+  /// Send an item on the channel with a deadline.
+  ///
+  /// Blocks until the channel is not full, the deadline is met, or the receiver
+  /// disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<void, TrySendError<T>> try_send_until(
+      T item, const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_until(std::move(item), deadline);
+  }
+
+  /// Send every item in a range on the channel.
+  ///
+  /// Blocks until every item is sent or the receiver disconnects. Free slots
+  /// are reserved for as many items as possible at once.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
+  /// Send up to `n` items, starting at `first`, on the channel without
+  /// blocking.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> try_send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_send_n(std::move(first), n);
+  }
+
+  /// Number of items in the channel.
+  ///
+  /// Since the channel's size could change at any moment, it should not be used
+  /// to determine if a send operation will block/fail.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_size() const {
+    assert(this->channel != nullptr);
+    return this->channel->size();
+  }
+
+  /// Number of items the channel has space for.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::size_t channel_capacity() const {
+    assert(this->channel != nullptr);
+    return this->channel->capacity;
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void release() {
+    if (this->channel) {
+      this->channel->release_sender();
+      this->memory.reset();
+    }
+  }
+
+public:
+  SendIter<Sender> begin() const { return SendIter(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::spsc::ipc
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef _CHAN_SPSC_IPC_CREATE_H
+#define _CHAN_SPSC_IPC_CREATE_H
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "../../detail/SharedMemory.hpp"
+#include "../../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::spsc::ipc {
+/// Create a new channel in a POSIX shared memory object and get its
+/// `Receiver`.
+///
+/// Another process connects to the channel with `connect_sender`. Until then,
+/// receiving blocks as if the channel were empty.
+///
+/// Throws `std::system_error` if the shared memory object can't be created,
+/// for example because one named `name` already exists.
+///
+/// # Parameters
+/// `name` - Name of the shared memory object, such as `"/capture"`
+/// `capacity` - Size of the channel's item buffer, which must not be 0
+///
+/// # Template parameters
+/// `T` - Channel's item type, which must be trivially copyable
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+template <typename T, typename W = wait::Park>
+Receiver<T, W> create_receiver(std::string name, std::size_t capacity) {
+  assert(capacity != 0);
+  auto memory = std::make_shared<detail::SharedMemory>(
+      detail::SharedMemory::create(name, Chan<T, W>::memory_size(capacity)));
+  auto channel = Chan<T, W>::create(*memory, capacity);
+  return Receiver<T, W>(std::move(memory), channel, std::move(name));
+}
+
+/// Connect to a channel that another process created with `create_receiver`
+/// and get its `Sender`.
+///
+/// Throws `std::system_error` if there is no such channel, its item type has a
+/// different size, or a sender has already connected to it.
+///
+/// # Parameters
+/// `name` - Name that was passed to `create_receiver`
+///
+/// # Template parameters
+/// `T` - Channel's item type, which must be trivially copyable
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+template <typename T, typename W = wait::Park>
+Sender<T, W> connect_sender(const std::string &name) {
+  auto memory =
+      std::make_shared<detail::SharedMemory>(detail::SharedMemory::open(name));
+  auto channel = Chan<T, W>::open(*memory);
+  if (!channel->connect_sender()) {
+    throw std::system_error(
+        std::make_error_code(std::errc::device_or_resource_busy),
+        "chan::spsc::ipc channel already has a sender");
+  }
+  return Sender<T, W>(std::move(memory), channel);
+}
+} // namespace chan::spsc::ipc
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef _CHAN_SPSC_OVERWRITING_CHANNEL_H
+#define _CHAN_SPSC_OVERWRITING_CHANNEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/EventCount.hpp"
+#include "../../detail/OverwritingChannel.hpp"
+#include "Packet.hpp"
+
+namespace chan::spsc::overwriting {
+/// Channel implementation.
+///
+/// The sender claims positions by advancing `tail_index`, which no other
+/// thread writes, and never waits for room. See `detail::OverwritingChannel`
+/// for how the oldest item is dropped when the channel is full.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T, typename W, typename A>
+class Chan : detail::OverwritingChannel<Chan<T, W, A>, T, W, A> {
+  friend struct detail::OverwritingChannel<Chan, T, W, A>;
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
+
+  A allocator;
+  std::allocator_traits<A>::pointer packet_buffer;
+  std::size_t capacity;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t head_index;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t tail_index;
+  alignas(detail::CACHE_LINE_SIZE) detail::EventCount<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t dropped_count;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_bool _send_done;
+  std::atomic_bool _recv_done;
+  std::atomic_bool disconnected;
+
+public:
+  /// Create a channel that assumes a single `Sender` and single `Receiver`.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(std::size_t capacity, A allocator)
+      : allocator(std::move(allocator)),
+        packet_buffer(
+            std::allocator_traits<A>::allocate(this->allocator, capacity)),
+        capacity(capacity), head_index(0), tail_index(0), dropped_count(0),
+        _send_done(false), _recv_done(false), disconnected(false) {
+    for (std::size_t index = 0; index < capacity; ++index) {
+      std::allocator_traits<A>::construct(
+          this->allocator, &this->packet_buffer[index].sequence, 2 * index);
+    }
+  }
+
+  ~Chan() {
+    for (std::size_t index = 0; index < this->capacity; ++index) {
+      auto &packet = this->packet_buffer[index];
+      if (packet.sequence.load(std::memory_order::relaxed) % 2 == 1) {
+        std::allocator_traits<A>::destroy(this->allocator, &packet.item);
+      }
+      std::allocator_traits<A>::destroy(this->allocator, &packet.sequence);
+    }
+
+    std::allocator_traits<A>::deallocate(this->allocator, this->packet_buffer,
+                                         this->capacity);
+  }
+
+private:
+  std::size_t claim_tail(std::size_t n) {
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    this->tail_index.store(tail_index + n, std::memory_order::relaxed);
+    return tail_index;
+  }
+
+  std::size_t size() const {
+    // Load the head first so the tail can't be behind it.
+    auto head_index = this->head_index.load(std::memory_order::relaxed);
+    auto tail_index = this->tail_index.load(std::memory_order::relaxed);
+    return std::min(tail_index - head_index, this->capacity);
+  }
+
+  bool send_done() const {
+    return this->_send_done.load(std::memory_order::acquire);
+  }
+
+  bool recv_done() const {
+    return this->_recv_done.load(std::memory_order::acquire);
+  }
+
+  bool release_sender() {
+    this->_send_done.store(true, std::memory_order::release);
+    this->recv_ready.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver() {
+    this->_recv_done.store(true, std::memory_order::release);
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::spsc::overwriting
+
+#endif
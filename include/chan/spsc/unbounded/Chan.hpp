@@ -1,37 +1,68 @@
 #ifndef _CHAN_SPSC_UNBOUNDED_CHANNEL_H
 #define _CHAN_SPSC_UNBOUNDED_CHANNEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <expected>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <utility>
 
+#include "../../DEFAULT_MAX_CHUNKS_PER_ALLOCATION.hpp"
+#include "../../RecvView.hpp"
 #include "../../SendError.hpp"
-#include "../../detail/SemaphoreType.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../SendSlot.hpp"
+#include "../../detail/CACHE_LINE_SIZE.hpp"
+#include "../../detail/Semaphore.hpp"
 #include "../../detail/UnboundedChannel.hpp"
 #include "ItemChunk.hpp"
 
 namespace chan::spsc::unbounded {
 /// Channel implementation.
 ///
+/// The chunks form a ring. Chunks between the tail chunk and the head chunk
+/// hold no items and are reused as the tail moves on. When the ring is full,
+/// the sender allocates a batch of chunks as large as the ring, up to
+/// `max_batch_size`, so a burst only needs a logarithmic number of
+/// allocations. A batch is deallocated once all of its chunks have been
+/// freed. When the sender moves to a new chunk, idle chunks beyond
+/// `idle_chunk_limit` are freed. `chunk_mutex` serializes changes to the ring
+/// between the sender and `shrink_to_fit`, so the sender only takes it once
+/// per chunk.
+///
 /// Aside from custom allocators, there is no reason to work with this class
 /// directly.
-template <typename T, std::size_t CHUNK_SIZE, typename A>
+template <typename T, std::size_t CHUNK_SIZE, typename W, typename A>
   requires(CHUNK_SIZE != 0)
-class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, A>, T> {
+class Chan : detail::UnboundedChannel<Chan<T, CHUNK_SIZE, W, A>, T> {
   friend struct detail::UnboundedChannel<Chan, T>;
-  template <typename, std::size_t, typename, typename> friend class Sender;
-  template <typename, std::size_t, typename, typename> friend class Receiver;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Sender;
+  template <typename, std::size_t, typename, typename, typename>
+  friend class Receiver;
+  template <typename, typename> friend class chan::SendSlot;
+  template <typename, typename> friend class chan::RecvView;
+
+  using Slot = T *;
 
   A allocator;
-  ItemChunk<T, CHUNK_SIZE> *tail_chunk;
+  alignas(detail::CACHE_LINE_SIZE) ItemChunk<T, CHUNK_SIZE> *tail_chunk;
   std::size_t tail_index;
-  ItemChunk<T, CHUNK_SIZE> *head_chunk;
+  std::mutex chunk_mutex;
+  alignas(detail::CACHE_LINE_SIZE)
+      std::atomic<ItemChunk<T, CHUNK_SIZE> *> head_chunk;
   std::size_t head_index;
-  std::atomic_size_t size;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t size;
   std::atomic_size_t capacity;
-  detail::SemaphoreType recv_ready;
-  std::atomic_bool _send_done;
+  std::atomic_size_t idle_chunk_limit;
+  std::atomic_size_t max_batch_size;
+  alignas(detail::CACHE_LINE_SIZE) detail::Semaphore<W> recv_ready;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_bool _send_done;
   std::atomic_bool disconnected;
 
 public:
@@ -43,13 +74,18 @@ public:
       : allocator(std::move(allocator)),
         tail_chunk(std::allocator_traits<A>::allocate(this->allocator, 1)),
         tail_index(0), head_chunk(this->tail_chunk), head_index(0), size(0),
-        capacity(CHUNK_SIZE), recv_ready(0), _send_done(false),
-        disconnected(false) {
+        capacity(CHUNK_SIZE),
+        idle_chunk_limit(std::numeric_limits<std::size_t>::max()),
+        max_batch_size(DEFAULT_MAX_CHUNKS_PER_ALLOCATION), recv_ready(0),
+        _send_done(false), disconnected(false) {
     this->tail_chunk->next = this->tail_chunk;
+    this->tail_chunk->batch = this->tail_chunk;
+    this->tail_chunk->batch_size = 1;
+    this->tail_chunk->freed_count = 0;
   }
 
   ~Chan() {
-    auto chunk = this->head_chunk;
+    auto chunk = this->head_chunk.load(std::memory_order::relaxed);
     auto index = this->head_index;
     while (chunk != this->tail_chunk || index != this->tail_index) {
       std::allocator_traits<A>::destroy(this->allocator, chunk->items + index);
@@ -60,10 +96,10 @@ public:
     }
 
     auto c = chunk->next;
-    std::allocator_traits<A>::deallocate(this->allocator, chunk, 1);
+    this->free_chunk(chunk);
     while (c != chunk) {
       auto next = c->next;
-      std::allocator_traits<A>::deallocate(this->allocator, c, 1);
+      this->free_chunk(c);
       c = next;
     }
   }
@@ -77,39 +113,183 @@ private:
     std::allocator_traits<A>::construct(
         this->allocator, this->tail_chunk->items + this->tail_index,
         std::move(item));
+    this->advance_tail(size);
+    this->recv_ready.release();
+    return {};
+  }
+
+  template <typename I> SendRangeResult<I> send_n(I first, std::size_t n) {
+    if (this->disconnected.load(std::memory_order::relaxed)) {
+      return {std::move(first), 0, true};
+    }
+    if (n == 0) {
+      return {std::move(first), 0, false};
+    }
+    auto size = this->size.fetch_add(n, std::memory_order::acquire);
+    for (std::size_t offset = 0; offset < n; ++offset, ++first) {
+      std::allocator_traits<A>::construct(
+          this->allocator, this->tail_chunk->items + this->tail_index,
+          std::ranges::iter_move(first));
+      this->advance_tail(size + offset);
+    }
+    this->recv_ready.release(static_cast<std::ptrdiff_t>(n));
+    return {std::move(first), n, false};
+  }
+
+  std::expected<T *, SendError<void>> reserve() {
+    if (this->disconnected.load(std::memory_order::relaxed)) {
+      return std::unexpected(SendError<void>{});
+    }
+    return this->tail_chunk->items + this->tail_index;
+  }
+
+  template <typename... Args> void construct_slot(T *slot, Args &&...args) {
+    std::allocator_traits<A>::construct(this->allocator, slot,
+                                        std::forward<Args>(args)...);
+  }
+
+  void commit_slot(T *) {
+    this->advance_tail(this->size.fetch_add(1, std::memory_order::acquire));
+    this->recv_ready.release();
+  }
+
+  /// Nothing was published, so the slot is simply reserved again next time.
+  void abandon_slot(T *) {}
+
+  /// Move past the item that was just constructed at the tail. `size` is the
+  /// number of items that were in the channel before it.
+  void advance_tail(std::size_t size) {
     if (this->tail_index != CHUNK_SIZE - 1) {
       ++this->tail_index;
     } else {
       this->tail_index = 0;
+      std::lock_guard _lock(this->chunk_mutex);
       if (size < this->capacity.load(std::memory_order::relaxed) - CHUNK_SIZE) {
         this->tail_chunk = this->tail_chunk->next;
       } else {
-        auto new_chunk = std::allocator_traits<A>::allocate(this->allocator, 1);
-        new_chunk->next = this->tail_chunk->next;
-        this->tail_chunk->next = new_chunk;
-        this->tail_chunk = new_chunk;
-        this->capacity.fetch_add(CHUNK_SIZE, std::memory_order::relaxed);
+        this->tail_chunk = this->allocate_batch(this->tail_chunk);
       }
+      this->free_idle_chunks(
+          this->idle_chunk_limit.load(std::memory_order::relaxed));
     }
-    this->recv_ready.release();
-    return {};
+  }
+
+  /// Link a batch of new chunks into the ring after `chunk` and return the
+  /// first one.
+  ///
+  /// The batch has as many chunks as the ring, but no more than
+  /// `max_batch_size` or `idle_chunk_limit`.
+  ///
+  /// Call while holding `chunk_mutex`.
+  ItemChunk<T, CHUNK_SIZE> *allocate_batch(ItemChunk<T, CHUNK_SIZE> *chunk) {
+    auto batch_size = std::max<std::size_t>(
+        std::min({this->capacity.load(std::memory_order::relaxed) / CHUNK_SIZE,
+                  this->max_batch_size.load(std::memory_order::relaxed),
+                  this->idle_chunk_limit.load(std::memory_order::relaxed)}),
+        1);
+    auto batch =
+        std::allocator_traits<A>::allocate(this->allocator, batch_size);
+    for (std::size_t offset = 0; offset < batch_size; ++offset) {
+      batch[offset].next = batch + offset + 1;
+      batch[offset].batch = batch;
+    }
+    batch->batch_size = batch_size;
+    batch->freed_count = 0;
+    batch[batch_size - 1].next = chunk->next;
+    chunk->next = batch;
+    this->capacity.fetch_add(batch_size * CHUNK_SIZE,
+                             std::memory_order::relaxed);
+    return batch;
+  }
+
+  /// Free the idle chunks after the tail chunk, except for the first `keep`.
+  ///
+  /// Call while holding `chunk_mutex`.
+  void free_idle_chunks(std::size_t keep) {
+    // The receiver only moves the head chunk forward after it has emptied the
+    // chunk it leaves, so every chunk between the tail and head is idle. A
+    // stale head is further back and only makes this keep more chunks.
+    auto head_chunk = this->head_chunk.load(std::memory_order::acquire);
+    auto chunk = this->tail_chunk;
+    for (; keep != 0 && chunk->next != head_chunk; --keep) {
+      chunk = chunk->next;
+    }
+    while (chunk->next != head_chunk) {
+      auto idle_chunk = chunk->next;
+      chunk->next = idle_chunk->next;
+      this->free_chunk(idle_chunk);
+      this->capacity.fetch_sub(CHUNK_SIZE, std::memory_order::relaxed);
+    }
+  }
+
+  /// Free `chunk`, and deallocate the chunks it was allocated with once they
+  /// have all been freed.
+  void free_chunk(ItemChunk<T, CHUNK_SIZE> *chunk) {
+    auto batch = chunk->batch;
+    if (++batch->freed_count == batch->batch_size) {
+      std::allocator_traits<A>::deallocate(this->allocator, batch,
+                                           batch->batch_size);
+    }
+  }
+
+  void shrink_to_fit() {
+    std::lock_guard _lock(this->chunk_mutex);
+    this->free_idle_chunks(0);
   }
 
   std::optional<T> do_recv() {
     if (this->size.load(std::memory_order::relaxed) == 0) {
       return {};
     }
-    auto &chan_item = this->head_chunk->items[this->head_index];
+    auto &chan_item = this->head_chunk.load(std::memory_order::relaxed)
+                          ->items[this->head_index];
     auto item = std::move(chan_item);
     std::allocator_traits<A>::destroy(this->allocator, &chan_item);
+    this->advance_head();
+    this->size.fetch_sub(1, std::memory_order::release);
+    return item;
+  }
+
+  template <typename O> std::size_t do_recv_n(O &out, std::size_t n) {
+    n = std::min(n, this->size.load(std::memory_order::relaxed));
+    for (std::size_t count = 0; count < n; ++count, ++out) {
+      auto &chan_item = this->head_chunk.load(std::memory_order::relaxed)
+                            ->items[this->head_index];
+      *out = std::move(chan_item);
+      std::allocator_traits<A>::destroy(this->allocator, &chan_item);
+      this->advance_head();
+    }
+    this->size.fetch_sub(n, std::memory_order::release);
+    return n;
+  }
+
+  std::optional<T *> do_peek() {
+    if (this->size.load(std::memory_order::relaxed) == 0) {
+      return {};
+    }
+    return this->head_chunk.load(std::memory_order::relaxed)->items +
+           this->head_index;
+  }
+
+  void release_slot(T *slot) {
+    std::allocator_traits<A>::destroy(this->allocator, slot);
+    this->advance_head();
+    this->size.fetch_sub(1, std::memory_order::release);
+  }
+
+  static T *slot_item(T *slot) { return slot; }
+
+  /// Move past the item that was just received. Publishes the new head chunk
+  /// only after the old one is empty, so the sender may free it.
+  void advance_head() {
     if (this->head_index != CHUNK_SIZE - 1) {
       ++this->head_index;
     } else {
       this->head_index = 0;
-      this->head_chunk = this->head_chunk->next;
+      this->head_chunk.store(
+          this->head_chunk.load(std::memory_order::relaxed)->next,
+          std::memory_order::release);
     }
-    this->size.fetch_sub(1, std::memory_order::release);
-    return item;
   }
 
   bool send_done() const {
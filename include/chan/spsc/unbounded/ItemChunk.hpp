@@ -10,6 +10,13 @@ namespace chan::spsc::unbounded {
 /// directly.
 template <typename T, std::size_t CHUNK_SIZE> struct ItemChunk {
   ItemChunk *next;
+  /// First of the chunks that were allocated together with this one.
+  ItemChunk *batch;
+  /// Number of chunks allocated together. Only used in the first chunk.
+  std::size_t batch_size;
+  /// Number of chunks allocated together that have been freed. Only used in
+  /// the first chunk.
+  std::size_t freed_count;
   T items[CHUNK_SIZE];
 };
 } // namespace chan::spsc::unbounded
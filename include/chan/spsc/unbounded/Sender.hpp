@@ -2,10 +2,21 @@
 #define _CHAN_SPSC_UNBOUNDED_SENDER_H
 
 #include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <ranges>
+#include <utility>
 
 #include "../../DEFAULT_CHUNK_SIZE.hpp"
 #include "../../SendIter.hpp"
+#include "../../SendRangeResult.hpp"
+#include "../../SendSlot.hpp"
+#include "../../detail/Awaiter.hpp"
+#include "../../detail/emplace_with.hpp"
+#include "../../detail/send_range_with.hpp"
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 
 namespace chan::spsc::unbounded {
@@ -14,6 +25,7 @@ namespace chan::spsc::unbounded {
 /// # Template parameters
 /// `T` - Channel's item type
 /// `CHUNK_SIZE` (optional) - Size of the channel's item chunks
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A1` (optional) - Allocator for the channel's item chunks
 /// `A2` (optional) - Allocator for the channel object
 ///
@@ -21,12 +33,16 @@ namespace chan::spsc::unbounded {
 /// Do not share a `Sender` between threads. If multiple threads need to
 /// send to the same channel, use mpsc instead of spsc.
 template <typename T, std::size_t CHUNK_SIZE = DEFAULT_CHUNK_SIZE,
+          typename W = wait::Park,
           typename A1 = std::allocator<ItemChunk<T, CHUNK_SIZE>>,
-          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, A1>>>
+          typename A2 = std::allocator<Chan<T, CHUNK_SIZE, W, A1>>>
 class Sender {
 public:
   using Item = T;
 
+  /// Handle returned by `reserve`.
+  using Slot = SendSlot<T, Chan<T, CHUNK_SIZE, W, A1>>;
+
 private:
   std::allocator_traits<A2>::pointer channel;
   A2 allocator;
@@ -80,6 +96,90 @@ public:
     return this->channel->send(std::move(item));
   }
 
+  /// Reserve a slot in the channel to construct an item in place.
+  ///
+  /// Does not block. Construct the item at `slot.get()` and call
+  /// `slot.commit()` to send it, which saves moving the item into the channel.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. See `SendSlot` for
+  /// what may be done while the slot is held.
+  std::expected<Slot, SendError<void>> reserve() const {
+    assert(this->channel != nullptr);
+    auto channel = std::to_address(this->channel);
+    auto slot = channel->reserve();
+    if (!slot) {
+      return std::unexpected(slot.error());
+    }
+    return Slot(channel, *slot);
+  }
+
+  /// Construct an item from `args` and send it on the channel.
+  ///
+  /// Does not block.
+  ///
+  /// The item is constructed directly in a reserved slot, which saves
+  /// constructing a temporary and moving it into the channel. If the
+  /// constructor throws, nothing is sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename... Args>
+    requires std::constructible_from<T, Args...>
+  std::expected<void, SendError<void>> emplace(Args &&...args) const {
+    assert(this->channel != nullptr);
+    return detail::emplace_with([this] { return this->reserve(); },
+                                std::forward<Args>(args)...);
+  }
+
+  /// Send an item on the channel in a coroutine.
+  ///
+  /// Sending never blocks, so `co_await tx.async_send(item, executor)` never
+  /// suspends the coroutine and does not use `executor`. It returns what
+  /// `send(item)` would have returned.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename E> auto async_send(T item, E) const {
+    return detail::ReadyAwaiter(this->send(std::move(item)));
+  }
+
+  /// Send every item in a range on the channel.
+  ///
+  /// Items are moved out of the range. Does not block. Space for all of the
+  /// items is reserved at once, so a batch costs about as much synchronization
+  /// as a single item.
+  ///
+  /// Returns an iterator to the first item that was not sent and the number of
+  /// items that were sent.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::ranges::input_range R>
+    requires std::constructible_from<T,
+                                     std::ranges::range_rvalue_reference_t<R>>
+  SendRangeResult<std::ranges::borrowed_iterator_t<R>>
+  send_range(R &&items) const {
+    assert(this->channel != nullptr);
+    return detail::send_range_with(
+        std::forward<R>(items), [this](auto first, std::size_t n) {
+          return this->channel->send_n(std::move(first), n);
+        });
+  }
+
+  /// Send `n` items, starting at `first`, on the channel.
+  ///
+  /// Behaves like `send_range`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <std::input_iterator I>
+    requires std::constructible_from<T, std::iter_rvalue_reference_t<I>>
+  SendRangeResult<I> send_n(I first, std::size_t n) const {
+    assert(this->channel != nullptr);
+    return this->channel->send_n(std::move(first), n);
+  }
+
   /// Number of items in the channel.
   ///
   /// # Safety
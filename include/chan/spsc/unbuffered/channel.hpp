@@ -1,6 +1,7 @@
 #ifndef _CHAN_SPSC_UNBUFFERED_CREATE_H
 #define _CHAN_SPSC_UNBUFFERED_CREATE_H
 
+#include "../../wait/Park.hpp"
 #include "Chan.hpp"
 #include "Receiver.hpp"
 #include "Sender.hpp"
@@ -13,13 +14,15 @@ namespace chan::spsc::unbuffered {
 ///
 /// # Template parameters
 /// `T` - Channel's item type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
 /// `A` (optional) - Type of `allocator` parameter
-template <typename T, typename A = std::allocator<Chan<T>>>
-std::pair<Sender<T, A>, Receiver<T, A>> channel(A allocator = A()) {
+template <typename T, typename W = wait::Park,
+          typename A = std::allocator<Chan<T, W>>>
+std::pair<Sender<T, W, A>, Receiver<T, W, A>> channel(A allocator = A()) {
   auto channel = std::allocator_traits<A>::allocate(allocator, 1);
   std::allocator_traits<A>::construct(allocator, channel);
-  Sender<T, A> sender(channel, allocator);
-  Receiver<T, A> receiver(std::move(channel), std::move(allocator));
+  Sender<T, W, A> sender(channel, allocator);
+  Receiver<T, W, A> receiver(std::move(channel), std::move(allocator));
   return {std::move(sender), std::move(receiver)};
 }
 } // namespace chan::spsc::unbuffered
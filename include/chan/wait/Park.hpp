@@ -0,0 +1,17 @@
+#ifndef _CHAN_WAIT_PARK_H
+#define _CHAN_WAIT_PARK_H
+
+#include <cstddef>
+
+namespace chan::wait {
+/// Wait strategy that sleeps right away until woken. This is the default.
+///
+/// Uses no CPU while waiting.
+struct Park {
+  /// Called each time a waiting thread finds that it can't proceed yet.
+  /// Returns `false` when the thread should sleep instead of checking again.
+  static bool pause(std::size_t) { return false; }
+};
+} // namespace chan::wait
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _CHAN_WAIT_SPIN_H
+#define _CHAN_WAIT_SPIN_H
+
+#include <cstddef>
+
+#include "../detail/cpu_relax.hpp"
+
+namespace chan::wait {
+/// Wait strategy that busy-spins and never sleeps.
+///
+/// Gives the lowest wake-up latency, but every waiting thread keeps a core
+/// fully busy. Only use it when each waiting thread has a core to itself.
+struct Spin {
+  /// Called each time a waiting thread finds that it can't proceed yet.
+  /// Returns `false` when the thread should sleep instead of checking again.
+  static bool pause(std::size_t) {
+    detail::cpu_relax();
+    return true;
+  }
+};
+} // namespace chan::wait
+
+#endif
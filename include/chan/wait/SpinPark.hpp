@@ -0,0 +1,26 @@
+#ifndef _CHAN_WAIT_SPIN_PARK_H
+#define _CHAN_WAIT_SPIN_PARK_H
+
+#include <cstddef>
+
+#include "../detail/cpu_relax.hpp"
+
+namespace chan::wait {
+/// Wait strategy that spins `SPIN_COUNT` times and then sleeps until woken.
+///
+/// Short waits avoid the cost of sleeping and waking up, and long waits use no
+/// CPU.
+template <std::size_t SPIN_COUNT = 100> struct SpinPark {
+  /// Called each time a waiting thread finds that it can't proceed yet.
+  /// Returns `false` when the thread should sleep instead of checking again.
+  static bool pause(std::size_t iteration) {
+    if (iteration < SPIN_COUNT) {
+      detail::cpu_relax();
+      return true;
+    }
+    return false;
+  }
+};
+} // namespace chan::wait
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef _CHAN_WAIT_SPIN_YIELD_H
+#define _CHAN_WAIT_SPIN_YIELD_H
+
+#include <cstddef>
+#include <thread>
+
+#include "../detail/cpu_relax.hpp"
+
+namespace chan::wait {
+/// Wait strategy that spins `SPIN_COUNT` times and then yields the thread on
+/// every check. Never sleeps.
+///
+/// Lets other threads run on the waiting thread's core while still reacting
+/// without a wake-up call.
+template <std::size_t SPIN_COUNT = 100> struct SpinYield {
+  /// Called each time a waiting thread finds that it can't proceed yet.
+  /// Returns `false` when the thread should sleep instead of checking again.
+  static bool pause(std::size_t iteration) {
+    if (iteration < SPIN_COUNT) {
+      detail::cpu_relax();
+    } else {
+      std::this_thread::yield();
+    }
+    return true;
+  }
+};
+} // namespace chan::wait
+
+#endif
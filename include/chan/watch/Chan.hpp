@@ -0,0 +1,190 @@
+#ifndef _CHAN_WATCH_CHANNEL_H
+#define _CHAN_WATCH_CHANNEL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <utility>
+
+#include "../RecvError.hpp"
+#include "../SendError.hpp"
+#include "../TryRecvError.hpp"
+#include "../detail/CACHE_LINE_SIZE.hpp"
+#include "../detail/WakeAllEvent.hpp"
+
+namespace chan::watch {
+/// Channel implementation.
+///
+/// The channel holds a single value behind a `std::shared_ptr`. Sending
+/// allocates the new value and swaps it in, so the sender never waits for
+/// receivers: a receiver that is still using the old value keeps it alive
+/// until it lets go of it.
+///
+/// Each value is allocated together with its version, which counts the values
+/// sent before it. Each `Receiver` remembers the version of the last value it
+/// received. `version` is set to the new value's version after the value is
+/// stored, so receivers can check for a change without touching the
+/// `std::shared_ptr`, and a value is never received twice.
+///
+/// Receivers wait for different versions, so they sleep on a `WakeAllEvent`
+/// and every send wakes all of them.
+///
+/// Aside from custom allocators, there is no reason to work with this class
+/// directly.
+template <typename T, typename W, typename A> class Chan {
+  template <typename, typename, typename, typename> friend class Sender;
+  template <typename, typename, typename, typename> friend class Receiver;
+
+  struct Snapshot {
+    std::size_t version;
+    T value;
+  };
+
+  A allocator;
+  std::atomic<std::shared_ptr<const Snapshot>> snapshot;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t version;
+  alignas(detail::CACHE_LINE_SIZE) detail::WakeAllEvent<W> changed;
+  alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t receiver_count;
+  std::atomic_bool _send_done;
+  std::atomic_bool disconnected;
+
+public:
+  /// Create a channel holding `value` with a single `Sender` and `Receiver`.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Chan(T value, A allocator)
+      : allocator(std::move(allocator)),
+        snapshot(std::allocate_shared<const Snapshot>(this->allocator, 0,
+                                                      std::move(value))),
+        version(0), receiver_count(1), _send_done(false), disconnected(false) {
+  }
+
+private:
+  std::expected<void, SendError<T>> send(T value) {
+    if (this->recv_done()) {
+      return std::unexpected(SendError{std::move(value)});
+    }
+    // Only the sender writes `version`.
+    auto version = this->version.load(std::memory_order::relaxed) + 1;
+    this->snapshot.store(std::allocate_shared<const Snapshot>(
+                             this->allocator, version, std::move(value)),
+                         std::memory_order::release);
+    this->version.store(version, std::memory_order::release);
+    this->changed.notify_all();
+    return {};
+  }
+
+  /// Latest value. Its version is stored in `seen`.
+  std::shared_ptr<const T> latest(std::size_t &seen) {
+    auto snapshot = this->snapshot.load(std::memory_order::acquire);
+    seen = snapshot->version;
+    auto value = &snapshot->value;
+    return std::shared_ptr<const T>(std::move(snapshot), value);
+  }
+
+  /// `version` can briefly lag behind the stored value, so `seen` can be
+  /// ahead of it.
+  bool has_changed(std::size_t seen) const {
+    return this->version.load(std::memory_order::acquire) > seen;
+  }
+
+  std::expected<void, RecvError> wait_changed(std::size_t seen) {
+    auto disconnected = false;
+    this->changed.wait(
+        [&] { return this->try_wait_changed_once(seen, disconnected); });
+    if (disconnected) {
+      return std::unexpected(RecvError{});
+    }
+    return {};
+  }
+
+  std::expected<std::shared_ptr<const T>, RecvError> recv(std::size_t &seen) {
+    if (auto result = this->wait_changed(seen); !result) {
+      return std::unexpected(result.error());
+    }
+    return this->latest(seen);
+  }
+
+  std::expected<std::shared_ptr<const T>, TryRecvError>
+  try_recv(std::size_t &seen) {
+    auto disconnected = false;
+    auto ready = this->try_wait_changed_once(seen, disconnected);
+    return this->try_recv_impl(seen, ready, disconnected);
+  }
+
+  template <typename Rep, typename Period>
+  std::expected<std::shared_ptr<const T>, TryRecvError>
+  try_recv_for(std::size_t &seen,
+               const std::chrono::duration<Rep, Period> &timeout) {
+    return this->try_recv_until(seen,
+                                std::chrono::steady_clock::now() + timeout);
+  }
+
+  template <typename Clock, typename Duration>
+  std::expected<std::shared_ptr<const T>, TryRecvError>
+  try_recv_until(std::size_t &seen,
+                 const std::chrono::time_point<Clock, Duration> &deadline) {
+    auto disconnected = false;
+    auto ready = this->changed.wait_until(
+        [&] { return this->try_wait_changed_once(seen, disconnected); },
+        deadline);
+    return this->try_recv_impl(seen, ready, disconnected);
+  }
+
+  /// Returns `true` when the wait is over, either because there is a value
+  /// newer than `seen` or because there is none and the sender disconnected.
+  bool try_wait_changed_once(std::size_t seen, bool &disconnected) {
+    if (this->has_changed(seen)) {
+      return true;
+    }
+    if (this->send_done()) {
+      // The sender may have sent between the version check and the
+      // `send_done` check, so check one more time.
+      disconnected = !this->has_changed(seen);
+      return true;
+    }
+    return false;
+  }
+
+  std::expected<std::shared_ptr<const T>, TryRecvError>
+  try_recv_impl(std::size_t &seen, bool ready, bool disconnected) {
+    if (disconnected) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Disconnected});
+    }
+    if (!ready) {
+      return std::unexpected(TryRecvError{TryRecvErrorKind::Empty});
+    }
+    return this->latest(seen);
+  }
+
+  bool send_done() const {
+    return this->_send_done.load(std::memory_order::acquire);
+  }
+
+  bool recv_done() const {
+    return this->receiver_count.load(std::memory_order::acquire) == 0;
+  }
+
+  void acquire_receiver() {
+    this->receiver_count.fetch_add(1, std::memory_order::relaxed);
+  }
+
+  bool release_sender() {
+    this->_send_done.store(true, std::memory_order::release);
+    this->changed.notify_all();
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+
+  bool release_receiver() {
+    if (this->receiver_count.fetch_sub(1, std::memory_order::acq_rel) != 1) {
+      return false;
+    }
+    return this->disconnected.exchange(true, std::memory_order::acq_rel);
+  }
+};
+} // namespace chan::watch
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef _CHAN_WATCH_RECEIVER_H
+#define _CHAN_WATCH_RECEIVER_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include "../RecvIter.hpp"
+#include "../Select.hpp"
+#include "../detail/Awaiter.hpp"
+#include "../wait/Park.hpp"
+#include "Chan.hpp"
+
+namespace chan::watch {
+/// Receiving half of a channel.
+///
+/// Every `Receiver` sees the channel's latest value. Receiving returns a
+/// value only once it is newer than the last value this `Receiver` received,
+/// so values that were replaced before this `Receiver` got to them are
+/// skipped. The value it starts with counts as received.
+///
+/// Values are shared, not copied: receiving returns a
+/// `std::shared_ptr<const T>` to the channel's value.
+///
+/// # Template parameters
+/// `T` - Channel's value type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Allocator for the channel's values
+/// `A2` (optional) - Allocator for the channel object
+///
+/// # Safety
+/// Do not share a `Receiver` between threads. If multiple threads need to
+/// receive from the same channel, give each thread a its own `Receiver` copy.
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+class Receiver {
+  friend class chan::Select;
+
+public:
+  using Item = std::shared_ptr<const T>;
+
+private:
+  std::allocator_traits<A2>::pointer channel;
+  A2 allocator;
+  /// Version of the last value this `Receiver` received.
+  mutable std::size_t seen_version;
+
+public:
+  /// Create the initial `Receiver` for a channel.
+  ///
+  /// This constructor should not be called directly. Instead, call the
+  /// `channel` function.
+  Receiver(std::allocator_traits<A2>::pointer channel, A2 allocator)
+      : channel(std::move(channel)), allocator(std::move(allocator)),
+        seen_version(0) {}
+
+  /// Create a null `Receiver`.
+  Receiver() : channel(nullptr), allocator(), seen_version(0) {}
+
+  ~Receiver() { this->release(); }
+
+  Receiver(Receiver &&other)
+      : channel(std::move(other.channel)),
+        allocator(std::move(other.allocator)),
+        seen_version(other.seen_version) {
+    other.channel = nullptr;
+  }
+
+  Receiver &operator=(Receiver &&other) {
+    if (this != &other) {
+      this->release();
+      this->channel = std::move(other.channel);
+      this->allocator = std::move(other.allocator);
+      this->seen_version = other.seen_version;
+      other.channel = nullptr;
+    }
+    return *this;
+  }
+
+  /// Create a `Receiver` that has received the same values as `other`.
+  Receiver(const Receiver &other)
+      : channel(other.channel), allocator(other.allocator),
+        seen_version(other.seen_version) {
+    this->acquire();
+  }
+
+  Receiver &operator=(const Receiver &other) {
+    if (this != &other) {
+      this->release();
+      this->channel = other.channel;
+      this->allocator = other.allocator;
+      this->seen_version = other.seen_version;
+      this->acquire();
+    }
+    return *this;
+  }
+
+  /// Return `true` if `this` is not connected to a channel.
+  bool is_null() const { return this->channel == nullptr; }
+
+  /// Return `!is_null()`.
+  explicit operator bool() const { return !this->is_null(); }
+
+  /// Get the channel's latest value and mark it as received.
+  ///
+  /// Does not block and never fails, even after the sender disconnects.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::shared_ptr<const T> latest() const {
+    assert(this->channel != nullptr);
+    return this->channel->latest(this->seen_version);
+  }
+
+  /// Return `true` if the channel has a value this `Receiver` has not
+  /// received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  bool has_changed() const {
+    assert(this->channel != nullptr);
+    return this->channel->has_changed(this->seen_version);
+  }
+
+  /// Block until the channel has a value this `Receiver` has not received.
+  ///
+  /// Fails if the sender disconnects first. Does not mark the value as
+  /// received; call `latest()` to get it.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<void, RecvError> wait_changed() const {
+    assert(this->channel != nullptr);
+    return this->channel->wait_changed(this->seen_version);
+  }
+
+  /// Receive the channel's value once it is newer than the last one this
+  /// `Receiver` received.
+  ///
+  /// Same as `wait_changed()` followed by `latest()`.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::shared_ptr<const T>, RecvError> recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->recv(this->seen_version);
+  }
+
+  /// Receive the channel's value without blocking, if it is newer than the
+  /// last one this `Receiver` received.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  std::expected<std::shared_ptr<const T>, TryRecvError> try_recv() const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv(this->seen_version);
+  }
+
+  /// Receive the channel's value once it is newer than the last one this
+  /// `Receiver` received, with a timeout.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Rep, typename Period>
+  std::expected<std::shared_ptr<const T>, TryRecvError>
+  try_recv_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_for(this->seen_version, timeout);
+  }
+
+  /// Receive the channel's value once it is newer than the last one this
+  /// `Receiver` received, with a deadline.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`.
+  template <typename Clock, typename Duration>
+  std::expected<std::shared_ptr<const T>, TryRecvError> try_recv_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    assert(this->channel != nullptr);
+    return this->channel->try_recv_until(this->seen_version, deadline);
+  }
+
+  /// Receive the channel's value in a coroutine.
+  ///
+  /// `co_await rx.async_recv(executor)` suspends the coroutine until the
+  /// channel has a value this `Receiver` has not received or the sender
+  /// disconnects, then returns what `recv()` would have returned. The
+  /// coroutine is resumed by a function object that is passed to `executor`,
+  /// which must queue it to run on some thread rather than run it right away.
+  ///
+  /// # Safety
+  /// Causes undefined behavior if `is_null()` is `true`. `this` must outlive
+  /// the `co_await`.
+  template <typename E> auto async_recv(E executor) const {
+    assert(this->channel != nullptr);
+    return detail::recv_awaiter(*this, this->wakers(), std::move(executor));
+  }
+
+  /// Disconnect from the channel.
+  ///
+  /// There is often no need to call this function because the destructor will
+  /// disconnect from the channel.
+  ///
+  /// After calling this function, `is_null()` will be `true`.
+  void disconnect() {
+    this->release();
+    this->channel = nullptr;
+  }
+
+private:
+  void acquire() {
+    if (this->channel) {
+      this->channel->acquire_receiver();
+    }
+  }
+
+  void release() {
+    if (this->channel && this->channel->release_receiver()) {
+      std::allocator_traits<A2>::destroy(this->allocator, this->channel);
+      std::allocator_traits<A2>::deallocate(this->allocator, this->channel, 1);
+    }
+  }
+
+  detail::WakerList &wakers() const {
+    return this->channel->changed.wakers();
+  }
+
+public:
+  RecvIter<Receiver> begin() const { return RecvIter<Receiver>(*this); }
+
+  std::default_sentinel_t end() const { return {}; }
+};
+} // namespace chan::watch
+
+#endif
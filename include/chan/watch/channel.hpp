@@ -0,0 +1,42 @@
+#ifndef _CHAN_WATCH_CREATE_H
+#define _CHAN_WATCH_CREATE_H
+
+#include "../wait/Park.hpp"
+#include "Chan.hpp"
+#include "Receiver.hpp"
+#include "Sender.hpp"
+
+namespace chan::watch {
+/// Create a new channel holding `value` and get a `Sender` and `Receiver` for
+/// it.
+///
+/// Sending replaces the value. Every copy of the `Receiver` can read the latest
+/// value or wait for it to change.
+///
+/// # Parameters
+/// `value` - Channel's initial value
+/// `value_allocator` (optional) - Allocator for the channel's values
+/// `channel_allocator` (optional) - Allocator for the channel object
+///
+/// # Template parameters
+/// `T` - Channel's value type
+/// `W` (optional) - Wait strategy for blocked threads, such as `wait::Spin`
+/// `A1` (optional) - Type of `value_allocator` parameter
+/// `A2` (optional) - Type of `channel_allocator` parameter
+template <typename T, typename W = wait::Park,
+          typename A1 = std::allocator<T>,
+          typename A2 = std::allocator<Chan<T, W, A1>>>
+std::pair<Sender<T, W, A1, A2>, Receiver<T, W, A1, A2>>
+channel(T value, A1 value_allocator = A1(), A2 channel_allocator = A2()) {
+  auto channel = std::allocator_traits<A2>::allocate(channel_allocator, 1);
+  std::allocator_traits<A2>::construct(channel_allocator, channel,
+                                       std::move(value),
+                                       std::move(value_allocator));
+  Sender<T, W, A1, A2> sender(channel, channel_allocator);
+  Receiver<T, W, A1, A2> receiver(std::move(channel),
+                                  std::move(channel_allocator));
+  return {std::move(sender), std::move(receiver)};
+}
+} // namespace chan::watch
+
+#endif
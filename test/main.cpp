@@ -1,25 +1,54 @@
+#include <condition_variable>
+#include <coroutine>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <ranges>
 #include <set>
+#include <span>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <system_error>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chan/Select.hpp>
+#include <chan/broadcast/bounded/channel.hpp>
 #include <chan/mpmc/bounded/channel.hpp>
+#include <chan/mpmc/priority/channel.hpp>
 #include <chan/mpmc/unbounded/channel.hpp>
 #include <chan/mpmc/unbuffered/channel.hpp>
 #include <chan/mpsc/bounded/channel.hpp>
+#include <chan/mpsc/bytes/channel.hpp>
+#include <chan/mpsc/ipc/channel.hpp>
+#include <chan/mpsc/overwriting/channel.hpp>
+#include <chan/mpsc/priority/channel.hpp>
 #include <chan/mpsc/unbounded/channel.hpp>
 #include <chan/mpsc/unbuffered/channel.hpp>
+#include <chan/oneshot/channel.hpp>
 #include <chan/spmc/bounded/channel.hpp>
 #include <chan/spmc/unbounded/channel.hpp>
 #include <chan/spmc/unbuffered/channel.hpp>
 #include <chan/spsc/bounded/channel.hpp>
+#include <chan/spsc/bytes/channel.hpp>
+#include <chan/spsc/ipc/channel.hpp>
+#include <chan/spsc/overwriting/channel.hpp>
 #include <chan/spsc/unbounded/channel.hpp>
 #include <chan/spsc/unbuffered/channel.hpp>
+#include <chan/wait/Spin.hpp>
+#include <chan/wait/SpinPark.hpp>
+#include <chan/wait/SpinYield.hpp>
+#include <chan/watch/channel.hpp>
 
 // clang-format off
 static_assert(std::movable<chan::spsc::bounded::Sender<int>>);
@@ -117,6 +146,99 @@ static_assert(std::ranges::output_range<chan::mpmc::unbuffered::Sender<int>, int
 static_assert(std::movable<chan::mpmc::unbuffered::Receiver<int>>);
 static_assert(std::copyable<chan::mpmc::unbuffered::Receiver<int>>);
 static_assert(std::ranges::input_range<chan::mpmc::unbuffered::Receiver<int>>);
+
+static_assert(std::movable<chan::spsc::overwriting::Sender<int>>);
+static_assert(!std::copyable<chan::spsc::overwriting::Sender<int>>);
+static_assert(std::ranges::output_range<chan::spsc::overwriting::Sender<int>, int>);
+
+static_assert(std::movable<chan::spsc::overwriting::Receiver<int>>);
+static_assert(!std::copyable<chan::spsc::overwriting::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::spsc::overwriting::Receiver<int>>);
+
+static_assert(std::movable<chan::mpsc::overwriting::Sender<int>>);
+static_assert(std::copyable<chan::mpsc::overwriting::Sender<int>>);
+static_assert(std::ranges::output_range<chan::mpsc::overwriting::Sender<int>, int>);
+
+static_assert(std::movable<chan::mpsc::overwriting::Receiver<int>>);
+static_assert(!std::copyable<chan::mpsc::overwriting::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::mpsc::overwriting::Receiver<int>>);
+
+static_assert(std::movable<chan::broadcast::bounded::Sender<int>>);
+static_assert(!std::copyable<chan::broadcast::bounded::Sender<int>>);
+static_assert(std::ranges::output_range<chan::broadcast::bounded::Sender<int>, int>);
+
+static_assert(std::movable<chan::broadcast::bounded::Receiver<int>>);
+static_assert(std::copyable<chan::broadcast::bounded::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::broadcast::bounded::Receiver<int>>);
+
+static_assert(std::movable<chan::watch::Sender<int>>);
+static_assert(!std::copyable<chan::watch::Sender<int>>);
+
+static_assert(std::movable<chan::watch::Receiver<int>>);
+static_assert(std::copyable<chan::watch::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::watch::Receiver<int>>);
+
+static_assert(std::movable<chan::oneshot::Sender<int>>);
+static_assert(!std::copyable<chan::oneshot::Sender<int>>);
+
+static_assert(std::movable<chan::oneshot::Receiver<int>>);
+static_assert(!std::copyable<chan::oneshot::Receiver<int>>);
+
+static_assert(std::movable<chan::mpsc::priority::Sender<int, 3>>);
+static_assert(std::copyable<chan::mpsc::priority::Sender<int, 3>>);
+static_assert(std::ranges::output_range<chan::mpsc::priority::Sender<int, 3>, int>);
+
+static_assert(std::movable<chan::mpsc::priority::Receiver<int, 3>>);
+static_assert(!std::copyable<chan::mpsc::priority::Receiver<int, 3>>);
+static_assert(std::ranges::input_range<chan::mpsc::priority::Receiver<int, 3>>);
+
+static_assert(std::movable<chan::mpmc::priority::Sender<int, 3>>);
+static_assert(std::copyable<chan::mpmc::priority::Sender<int, 3>>);
+static_assert(std::ranges::output_range<chan::mpmc::priority::Sender<int, 3>, int>);
+
+static_assert(std::movable<chan::mpmc::priority::Receiver<int, 3>>);
+static_assert(std::copyable<chan::mpmc::priority::Receiver<int, 3>>);
+static_assert(std::ranges::input_range<chan::mpmc::priority::Receiver<int, 3>>);
+
+static_assert(std::movable<chan::spsc::ipc::Sender<int>>);
+static_assert(!std::copyable<chan::spsc::ipc::Sender<int>>);
+static_assert(std::ranges::output_range<chan::spsc::ipc::Sender<int>, int>);
+
+static_assert(std::movable<chan::spsc::ipc::Receiver<int>>);
+static_assert(!std::copyable<chan::spsc::ipc::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::spsc::ipc::Receiver<int>>);
+
+static_assert(std::movable<chan::mpsc::ipc::Sender<int>>);
+static_assert(std::copyable<chan::mpsc::ipc::Sender<int>>);
+static_assert(std::ranges::output_range<chan::mpsc::ipc::Sender<int>, int>);
+
+static_assert(std::movable<chan::mpsc::ipc::Receiver<int>>);
+static_assert(!std::copyable<chan::mpsc::ipc::Receiver<int>>);
+static_assert(std::ranges::input_range<chan::mpsc::ipc::Receiver<int>>);
+
+static_assert(std::movable<chan::spsc::bounded::Sender<int>::Slot>);
+static_assert(!std::copyable<chan::spsc::bounded::Sender<int>::Slot>);
+static_assert(std::movable<chan::spsc::bounded::Receiver<int>::View>);
+static_assert(!std::copyable<chan::spsc::bounded::Receiver<int>::View>);
+
+template <typename S, typename... Args>
+concept Emplaceable = requires(const S &tx, Args &&...args) { tx.emplace(std::forward<Args>(args)...); };
+
+static_assert(Emplaceable<chan::spsc::bounded::Sender<std::string>, int, char>);
+static_assert(!Emplaceable<chan::spsc::bounded::Sender<std::string>, std::vector<int>>);
+static_assert(Emplaceable<chan::mpsc::unbounded::Sender<std::string>, const char *>);
+static_assert(!Emplaceable<chan::mpsc::unbounded::Sender<std::string>, std::vector<int>>);
+static_assert(std::movable<chan::spsc::bytes::Sender<>>);
+static_assert(!std::copyable<chan::spsc::bytes::Sender<>>);
+static_assert(std::movable<chan::spsc::bytes::Receiver<>>);
+static_assert(!std::copyable<chan::spsc::bytes::Receiver<>>);
+static_assert(!std::copyable<chan::spsc::bytes::Receiver<>::Message>);
+
+static_assert(std::movable<chan::mpsc::bytes::Sender<>>);
+static_assert(std::copyable<chan::mpsc::bytes::Sender<>>);
+static_assert(std::movable<chan::mpsc::bytes::Receiver<>>);
+static_assert(!std::copyable<chan::mpsc::bytes::Receiver<>>);
+static_assert(!std::copyable<chan::mpsc::bytes::Receiver<>::Message>);
 // clang-format on
 
 template <typename S, typename R> void disconnect_sender(S tx, R rx) {
@@ -1389,6 +1511,437 @@ template <typename S, typename R> void add_remove_sender_receiver(S tx, R rx) {
   }
 }
 
+template <typename S, typename R> void send_range(S tx, R rx) {
+  std::vector<int> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.push_back(i);
+  }
+
+  std::vector<int> received;
+  std::thread rx_thread([&received, rx = std::move(rx)]() mutable {
+    while (auto item = rx.recv()) {
+      received.push_back(*item);
+    }
+  });
+
+  auto result = tx.send_range(items);
+  tx.disconnect();
+  rx_thread.join();
+
+  if (result.disconnected) {
+    throw std::runtime_error("send_range reported a disconnect");
+  }
+  if (result.count != items.size() || result.next != items.end()) {
+    std::ostringstream os;
+    os << "expected send_range to send " << items.size()
+       << " items but it sent " << result.count;
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (received != items) {
+    throw std::runtime_error("items from send_range received out of order");
+  }
+}
+
+template <typename S, typename R> void send_range_disconnected(S tx, R rx) {
+  rx.disconnect();
+  std::vector<int> items{1, 2, 3};
+  auto result = tx.send_range(items);
+  if (!result.disconnected) {
+    throw std::runtime_error("expected send_range to report a disconnect");
+  }
+  if (result.count != 0 || result.next != items.begin()) {
+    throw std::runtime_error("send_range sent items with no receiver");
+  }
+}
+
+template <typename S, typename R>
+void bounded_try_send_n(S tx, R rx, std::size_t buffer_capacity) {
+  std::vector<int> items;
+  for (int i = 0; i < int(buffer_capacity) + 4; ++i) {
+    items.push_back(i);
+  }
+  auto result = tx.try_send_n(items.begin(), items.size());
+  if (result.disconnected) {
+    throw std::runtime_error("try_send_n reported a disconnect");
+  }
+  if (result.count != buffer_capacity ||
+      result.next != items.begin() + buffer_capacity) {
+    std::ostringstream os;
+    os << "expected try_send_n to send " << buffer_capacity
+       << " items but it sent " << result.count;
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (auto result = tx.try_send_n(items.begin(), 1); result.count != 0) {
+    throw std::runtime_error("try_send_n sent an item to a full channel");
+  }
+  for (int i = 0; i < int(buffer_capacity); ++i) {
+    auto item = rx.recv();
+    if (!item || *item != i) {
+      std::ostringstream os;
+      os << "wrong item after try_send_n: expected " << i;
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+}
+
+template <typename S, typename R> void unbuffered_try_send_n(S tx, R rx) {
+  std::vector<int> items{1, 2, 3};
+  auto result = tx.try_send_n(items.begin(), items.size());
+  if (result.disconnected || result.count != 0 ||
+      result.next != items.begin()) {
+    throw std::runtime_error("try_send_n sent items with no receiver waiting");
+  }
+  rx.disconnect();
+  result = tx.try_send_n(items.begin(), items.size());
+  if (!result.disconnected) {
+    throw std::runtime_error("expected try_send_n to report a disconnect");
+  }
+}
+
+template <typename S, typename R> void recv_many(S tx, R rx) {
+  std::thread tx_thread([tx = std::move(tx)]() mutable {
+    for (int i = 0; i < 1000; ++i) {
+      tx.send(i);
+    }
+  });
+
+  std::vector<int> received;
+  std::vector<int> buffer(64);
+  while (auto count = rx.recv_many(buffer)) {
+    if (*count == 0 || *count > buffer.size()) {
+      std::ostringstream os;
+      os << "recv_many returned a count of " << *count;
+      throw std::runtime_error(std::move(os).str());
+    }
+    received.insert(received.end(), buffer.begin(), buffer.begin() + *count);
+  }
+  tx_thread.join();
+
+  if (received.size() != 1000) {
+    std::ostringstream os;
+    os << "expected to recv 1000 items but got " << received.size();
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 0; i < 1000; ++i) {
+    if (received[i] != i) {
+      std::ostringstream os;
+      os << "wrong item from recv_many: expected " << i << " got "
+         << received[i];
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+}
+
+template <typename S, typename R> void try_recv_many(S tx, R rx) {
+  for (int i = 0; i < 10; ++i) {
+    tx.send(i);
+  }
+  std::vector<int> buffer(4);
+  if (auto count = rx.try_recv_many(buffer); !count || *count != 4) {
+    throw std::runtime_error("expected try_recv_many to receive 4 items");
+  }
+  std::vector<int> drained;
+  if (auto count = rx.drain_into(std::back_inserter(drained));
+      !count || *count != 6) {
+    throw std::runtime_error("expected drain_into to receive 6 items");
+  }
+  buffer.insert(buffer.end(), drained.begin(), drained.end());
+  for (int i = 0; i < 10; ++i) {
+    if (buffer[i] != i) {
+      std::ostringstream os;
+      os << "wrong item from try_recv_many: expected " << i << " got "
+         << buffer[i];
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  if (auto count = rx.try_recv_many(buffer);
+      count || !count.error().is_empty()) {
+    throw std::runtime_error("expected try_recv_many error to be \"empty\"");
+  }
+  tx.disconnect();
+  if (auto count = rx.try_recv_many(buffer);
+      count || !count.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_recv_many error to be \"disconnected\"");
+  }
+}
+
+template <typename S, typename R> void unbuffered_try_recv_many(S tx, R rx) {
+  std::vector<int> buffer(4);
+  if (auto count = rx.try_recv_many(buffer);
+      count || !count.error().is_empty()) {
+    throw std::runtime_error("expected try_recv_many error to be \"empty\"");
+  }
+  tx.disconnect();
+  if (auto count = rx.drain_into(buffer.begin());
+      count || !count.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected drain_into error to be \"disconnected\"");
+  }
+}
+
+template <typename S, typename R> void unbounded_shrink_to_fit(S tx, R rx) {
+  for (int i = 0; i < 8; ++i) {
+    tx.send(i);
+  }
+  for (int i = 0; i < 8; ++i) {
+    rx.recv();
+  }
+  if (auto capacity = rx.channel_capacity(); capacity != 16) {
+    std::ostringstream os;
+    os << "wrong capacity before shrink_to_fit: expected 16 got " << capacity;
+    throw std::runtime_error(std::move(os).str());
+  }
+  rx.shrink_to_fit();
+  if (auto capacity = rx.channel_capacity(); capacity != 2) {
+    std::ostringstream os;
+    os << "wrong capacity after shrink_to_fit: expected 2 got " << capacity;
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 0; i < 4; ++i) {
+    tx.send(i);
+  }
+  for (int i = 0; i < 4; ++i) {
+    if (auto item = rx.recv(); !item || *item != i) {
+      throw std::runtime_error("wrong item after shrink_to_fit");
+    }
+  }
+}
+
+template <typename S, typename R>
+void unbounded_idle_chunk_limit(S tx, R rx) {
+  for (int i = 0; i < 8; ++i) {
+    tx.send(i);
+  }
+  for (int i = 0; i < 8; ++i) {
+    rx.recv();
+  }
+  rx.set_idle_chunk_limit(1);
+  tx.send(8);
+  tx.send(9);
+  if (auto capacity = rx.channel_capacity(); capacity != 6) {
+    std::ostringstream os;
+    os << "wrong capacity with an idle chunk limit of 1: expected 6 got "
+       << capacity;
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 8; i < 10; ++i) {
+    if (auto item = rx.recv(); !item || *item != i) {
+      throw std::runtime_error("wrong item with an idle chunk limit");
+    }
+  }
+}
+
+template <typename S, typename R>
+void unbounded_chunks_per_allocation(S tx, R rx) {
+  rx.set_max_chunks_per_allocation(1);
+  for (int i = 0; i < 8; ++i) {
+    tx.send(i);
+  }
+  if (auto capacity = rx.channel_capacity(); capacity != 10) {
+    std::ostringstream os;
+    os << "wrong capacity with one chunk per allocation: expected 10 got "
+       << capacity;
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 0; i < 8; ++i) {
+    if (auto item = rx.recv(); !item || *item != i) {
+      throw std::runtime_error("wrong item with one chunk per allocation");
+    }
+  }
+  rx.shrink_to_fit();
+  if (auto capacity = rx.channel_capacity(); capacity != 2) {
+    std::ostringstream os;
+    os << "wrong capacity after shrink_to_fit: expected 2 got " << capacity;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+template <typename S, typename R> void select_recv(S tx, R rx) {
+  auto [idle_tx, idle_rx] = chan::spsc::bounded::channel<int>(1);
+  std::optional<std::expected<int, chan::RecvError>> result;
+  chan::Select select;
+  select.recv(idle_rx, [](std::expected<int, chan::RecvError>) {
+    throw std::runtime_error("select received from the wrong channel");
+  });
+  auto index = select.recv(
+      rx, [&](std::expected<int, chan::RecvError> item) { result = item; });
+  if (select.try_wait()) {
+    throw std::runtime_error("expected try_wait to find nothing ready");
+  }
+  if (select.wait_for(std::chrono::milliseconds(1))) {
+    throw std::runtime_error("expected wait_for to time out");
+  }
+  std::thread sender([&tx] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tx.send(7);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tx.disconnect();
+  });
+  if (select.wait() != index || !result || !*result || **result != 7) {
+    throw std::runtime_error("wrong item from select");
+  }
+  result.reset();
+  if (select.wait() != index || !result || *result) {
+    throw std::runtime_error("expected select to see the disconnect");
+  }
+  sender.join();
+}
+
+template <typename S, typename R> void select_send(S tx, R rx) {
+  auto [idle_tx, idle_rx] = chan::spsc::bounded::channel<int>(0);
+  std::optional<std::expected<void, chan::SendError<int>>> result;
+  chan::Select select;
+  select.send(idle_tx, 1, [](std::expected<void, chan::SendError<int>>) {
+    throw std::runtime_error("select sent on the wrong channel");
+  });
+  auto index =
+      select.send(tx, 7, [&](std::expected<void, chan::SendError<int>> sent) {
+        result = std::move(sent);
+      });
+  std::thread receiver([&rx] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (auto item = rx.recv(); !item || *item != 7) {
+      throw std::runtime_error("wrong item sent by select");
+    }
+    rx.disconnect();
+  });
+  if (select.wait() != index || !result || !*result) {
+    throw std::runtime_error("expected select to send");
+  }
+  receiver.join();
+  if (select.try_wait()) {
+    throw std::runtime_error("expected select to send only once");
+  }
+  result.reset();
+  chan::Select disconnected;
+  disconnected.send(tx, 8,
+                    [&](std::expected<void, chan::SendError<int>> sent) {
+                      result = std::move(sent);
+                    });
+  if (disconnected.wait() != 0 || !result || *result ||
+      result->error().item != 8) {
+    throw std::runtime_error("expected select to see the disconnect");
+  }
+}
+
+/// Thread pool that resumes the coroutines in the coroutine tests.
+class ThreadPool {
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::deque<std::function<void()>> tasks;
+  bool stopping;
+  std::vector<std::thread> threads;
+
+public:
+  explicit ThreadPool(std::size_t size) : stopping(false) {
+    for (std::size_t i = 0; i < size; ++i) {
+      this->threads.emplace_back([this] { this->run(); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard _lock(this->mutex);
+      this->stopping = true;
+    }
+    this->ready.notify_all();
+    for (auto &thread : this->threads) {
+      thread.join();
+    }
+  }
+
+  auto executor() {
+    return [this](std::function<void()> task) {
+      {
+        std::lock_guard _lock(this->mutex);
+        this->tasks.push_back(std::move(task));
+      }
+      this->ready.notify_one();
+    };
+  }
+
+private:
+  void run() {
+    while (true) {
+      std::unique_lock lock(this->mutex);
+      this->ready.wait(
+          lock, [this] { return this->stopping || !this->tasks.empty(); });
+      if (this->tasks.empty()) {
+        return;
+      }
+      auto task = std::move(this->tasks.front());
+      this->tasks.pop_front();
+      lock.unlock();
+      task();
+    }
+  }
+};
+
+/// Coroutine that starts right away and frees itself when it finishes.
+struct Task {
+  struct promise_type {
+    Task get_return_object() { return {}; }
+    std::suspend_never initial_suspend() { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+template <typename R, typename E>
+Task recv_all(R rx, E executor, std::promise<int> &sum) {
+  int total = 0;
+  while (auto item = co_await rx.async_recv(executor)) {
+    total += *item;
+  }
+  sum.set_value(total);
+}
+
+template <typename S, typename E> Task send_all(S tx, E executor) {
+  for (int i = 1; i <= 1000; ++i) {
+    if (!co_await tx.async_send(i, executor)) {
+      break;
+    }
+  }
+}
+
+template <typename S, typename R> void coroutine_recv(S tx, R rx) {
+  std::promise<int> sum;
+  auto result = sum.get_future();
+  ThreadPool pool(2);
+  recv_all(std::move(rx), pool.executor(), sum);
+  std::thread sender(
+      [](S tx) {
+        for (int i = 1; i <= 1000; ++i) {
+          tx.send(i);
+        }
+      },
+      std::move(tx));
+  sender.join();
+  if (auto total = result.get(); total != 500500) {
+    std::ostringstream os;
+    os << "wrong sum from async_recv: expected 500500 got " << total;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+template <typename S, typename R> void coroutine_send(S tx, R rx) {
+  int total = 0;
+  {
+    ThreadPool pool(2);
+    send_all(std::move(tx), pool.executor());
+    for (auto item = rx.recv(); item; item = rx.recv()) {
+      total += *item;
+    }
+  }
+  if (total != 500500) {
+    std::ostringstream os;
+    os << "wrong sum from async_send: expected 500500 got " << total;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
 void spsc_bounded_disconnect_sender() {
   auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
   disconnect_sender(std::move(tx), std::move(rx));
@@ -1444,6 +1997,72 @@ void spsc_bounded_one_to_one_disconnect_receiver_buffer_size_1() {
   one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
 }
 
+void spsc_bounded_send_range() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_send_range_buffer_size_1() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(1);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_send_range_disconnected() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_try_send_n() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void spsc_bounded_recv_many() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_recv_many_buffer_size_1() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(1);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_try_recv_many() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_select_recv() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_select_send() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_coroutine_recv() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_coroutine_send() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int>(16);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_two_consecutive_spin() {
+  auto [tx, rx] = chan::spsc::bounded::channel<int, chan::wait::Spin>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_one_to_one_disconnect_sender_spin_yield() {
+  auto [tx, rx] =
+      chan::spsc::bounded::channel<int, chan::wait::SpinYield<>>(16);
+  one_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
 void spsc_unbounded_disconnect_sender() {
   auto [tx, rx] = chan::spsc::unbounded::channel<int>();
   disconnect_sender(std::move(tx), std::move(rx));
@@ -1499,6 +2118,71 @@ void spsc_unbounded_one_to_one_disconnect_receiver_chunk_size_1() {
   one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
 }
 
+void spsc_unbounded_send_range() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_send_range_chunk_size_1() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int, 1>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_send_range_disconnected() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_recv_many() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_recv_many_chunk_size_1() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int, 1>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_try_recv_many() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_shrink_to_fit() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int, 2>();
+  unbounded_shrink_to_fit(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_idle_chunk_limit() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int, 2>();
+  unbounded_idle_chunk_limit(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_chunks_per_allocation() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int, 2>();
+  unbounded_chunks_per_allocation(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_select_recv() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_select_send() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_coroutine_recv() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_coroutine_send() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void spsc_unbuffered_disconnect_sender() {
   auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
   unbuffered_disconnect_sender(std::move(tx), std::move(rx));
@@ -1524,13 +2208,63 @@ void spsc_unbuffered_one_to_one_disconnect_receiver() {
   one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
 }
 
-void mpsc_bounded_disconnect_sender() {
-  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
-  disconnect_sender(std::move(tx), std::move(rx));
+void spsc_unbuffered_send_range() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  send_range(std::move(tx), std::move(rx));
 }
 
-void mpsc_bounded_disconnect_receiver() {
-  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+void spsc_unbuffered_send_range_disconnected() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_try_send_n() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  unbuffered_try_send_n(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_recv_many() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_try_recv_many() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  unbuffered_try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_select_recv() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_select_send() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_coroutine_recv() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_coroutine_send() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void spsc_unbuffered_try_spin() {
+  auto [tx, rx] = chan::spsc::unbuffered::channel<int, chan::wait::Spin>();
+  unbuffered_try(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_disconnect_sender() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_disconnect_receiver() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
   disconnect_receiver(std::move(tx), std::move(rx));
 }
 
@@ -1604,6 +2338,61 @@ void mpsc_bounded_add_remove_sender() {
   add_remove_sender(std::move(tx), std::move(rx));
 }
 
+void mpsc_bounded_send_range() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_send_range_buffer_size_1() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(1);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_send_range_disconnected() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_try_send_n() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void mpsc_bounded_recv_many() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_recv_many_buffer_size_1() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(1);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_try_recv_many() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_select_recv() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_select_send() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_coroutine_recv() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_coroutine_send() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<int>(16);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void mpsc_unbounded_disconnect_sender() {
   auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
   disconnect_sender(std::move(tx), std::move(rx));
@@ -1684,6 +2473,77 @@ void mpsc_unbounded_add_remove_sender() {
   add_remove_sender(std::move(tx), std::move(rx));
 }
 
+void mpsc_unbounded_send_range() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_send_range_chunk_size_1() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, 1>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_send_range_disconnected() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_recv_many() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_recv_many_chunk_size_1() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, 1>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_try_recv_many() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_shrink_to_fit() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, 2>();
+  unbounded_shrink_to_fit(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_idle_chunk_limit() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, 2>();
+  unbounded_idle_chunk_limit(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_chunks_per_allocation() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, 2>();
+  unbounded_chunks_per_allocation(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_select_recv() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_select_send() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_coroutine_recv() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_coroutine_send() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_many_to_one_disconnect_sender_spin_yield() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<int, chan::DEFAULT_CHUNK_SIZE,
+                                                  chan::wait::SpinYield<>>();
+  many_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
 void mpsc_unbuffered_disconnect_sender() {
   auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
   unbuffered_disconnect_sender(std::move(tx), std::move(rx));
@@ -1724,6 +2584,51 @@ void mpsc_unbuffered_add_remove_sender() {
   add_remove_sender(std::move(tx), std::move(rx));
 }
 
+void mpsc_unbuffered_send_range() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_send_range_disconnected() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_try_send_n() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  unbuffered_try_send_n(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_recv_many() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_try_recv_many() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  unbuffered_try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_select_recv() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_select_send() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_coroutine_recv() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbuffered_coroutine_send() {
+  auto [tx, rx] = chan::mpsc::unbuffered::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void spmc_bounded_disconnect_sender() {
   auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
   disconnect_sender(std::move(tx), std::move(rx));
@@ -1804,6 +2709,61 @@ void spmc_bounded_add_remove_receiver() {
   add_remove_receiver(std::move(tx), std::move(rx));
 }
 
+void spmc_bounded_send_range() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_send_range_buffer_size_1() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(1);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_send_range_disconnected() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_try_send_n() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void spmc_bounded_recv_many() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_recv_many_buffer_size_1() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(1);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_try_recv_many() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_select_recv() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_select_send() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_coroutine_recv() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_bounded_coroutine_send() {
+  auto [tx, rx] = chan::spmc::bounded::channel<int>(16);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void spmc_unbounded_disconnect_sender() {
   auto [tx, rx] = chan::spmc::unbounded::channel<int>();
   disconnect_sender(std::move(tx), std::move(rx));
@@ -1884,6 +2844,71 @@ void spmc_unbounded_add_remove_receiver() {
   add_remove_receiver(std::move(tx), std::move(rx));
 }
 
+void spmc_unbounded_send_range() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_send_range_chunk_size_1() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int, 1>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_send_range_disconnected() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_recv_many() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_recv_many_chunk_size_1() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int, 1>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_try_recv_many() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_shrink_to_fit() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int, 2>();
+  unbounded_shrink_to_fit(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_idle_chunk_limit() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int, 2>();
+  unbounded_idle_chunk_limit(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_chunks_per_allocation() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int, 2>();
+  unbounded_chunks_per_allocation(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_select_recv() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_select_send() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_coroutine_recv() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_unbounded_coroutine_send() {
+  auto [tx, rx] = chan::spmc::unbounded::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void spmc_unbuffered_disconnect_sender() {
   auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
   unbuffered_disconnect_sender(std::move(tx), std::move(rx));
@@ -1924,6 +2949,57 @@ void spmc_unbuffered_add_remove_receiver() {
   add_remove_receiver(std::move(tx), std::move(rx));
 }
 
+void spmc_unbuffered_send_range() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_send_range_disconnected() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_try_send_n() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  unbuffered_try_send_n(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_recv_many() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_try_recv_many() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  unbuffered_try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_select_recv() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_select_send() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_coroutine_recv() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_coroutine_send() {
+  auto [tx, rx] = chan::spmc::unbuffered::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void spmc_unbuffered_one_to_many_disconnect_sender_spin_park() {
+  auto [tx, rx] =
+      chan::spmc::unbuffered::channel<int, chan::wait::SpinPark<>>();
+  one_to_many_disconnect_sender(std::move(tx), std::move(rx));
+}
+
 void mpmc_bounded_disconnect_sender() {
   auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
   disconnect_sender(std::move(tx), std::move(rx));
@@ -2054,34 +3130,99 @@ void mpmc_bounded_add_remove_sender_receiver() {
   add_remove_sender_receiver(std::move(tx), std::move(rx));
 }
 
-void mpmc_unbounded_disconnect_sender() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
-  disconnect_sender(std::move(tx), std::move(rx));
+void mpmc_bounded_send_range() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
 }
 
-void mpmc_unbounded_disconnect_receiver() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
-  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+void mpmc_bounded_send_range_buffer_size_1() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(1);
+  send_range(std::move(tx), std::move(rx));
 }
 
-void mpmc_unbounded_one_item() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
-  one_item(std::move(tx), std::move(rx));
+void mpmc_bounded_send_range_disconnected() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
 }
 
-void mpmc_unbounded_two_seperate() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
-  two_seperate(std::move(tx), std::move(rx));
+void mpmc_bounded_try_send_n() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
 }
 
-void mpmc_unbounded_two_consecutive() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
-  two_consecutive(std::move(tx), std::move(rx));
+void mpmc_bounded_recv_many() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
 }
 
-void mpmc_unbounded_leftover() {
-  auto [tx, rx] = chan::mpmc::unbounded::channel<std::unique_ptr<int>, 2>();
-  leftover(std::move(tx), std::move(rx));
+void mpmc_bounded_recv_many_buffer_size_1() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(1);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_try_recv_many() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_select_recv() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_select_send() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_coroutine_recv() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_coroutine_send() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int>(16);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_many_to_many_disconnect_sender_spin_park() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int, chan::wait::SpinPark<>>(16);
+  many_to_many_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_bounded_try_spin() {
+  auto [tx, rx] = chan::mpmc::bounded::channel<int, chan::wait::Spin>(16);
+  bounded_try(std::move(tx), std::move(rx), 16);
+}
+
+void mpmc_unbounded_disconnect_sender() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_disconnect_receiver() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_one_item() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  one_item(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_two_seperate() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_two_consecutive() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_leftover() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<std::unique_ptr<int>, 2>();
+  leftover(std::move(tx), std::move(rx));
 }
 
 void mpmc_unbounded_try() {
@@ -2184,6 +3325,71 @@ void mpmc_unbounded_add_remove_sender_receiver() {
   add_remove_sender_receiver(std::move(tx), std::move(rx));
 }
 
+void mpmc_unbounded_send_range() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_send_range_chunk_size_1() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int, 1>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_send_range_disconnected() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_recv_many() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_recv_many_chunk_size_1() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int, 1>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_try_recv_many() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_shrink_to_fit() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int, 2>();
+  unbounded_shrink_to_fit(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_idle_chunk_limit() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int, 2>();
+  unbounded_idle_chunk_limit(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_chunks_per_allocation() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int, 2>();
+  unbounded_chunks_per_allocation(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_select_recv() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_select_send() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_coroutine_recv() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbounded_coroutine_send() {
+  auto [tx, rx] = chan::mpmc::unbounded::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
 void mpmc_unbuffered_disconnect_sender() {
   auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
   unbuffered_disconnect_sender(std::move(tx), std::move(rx));
@@ -2254,6 +3460,2362 @@ void mpmc_unbuffered_add_remove_sender_receiver() {
   add_remove_sender_receiver(std::move(tx), std::move(rx));
 }
 
+void mpmc_unbuffered_send_range() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_send_range_disconnected() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_try_send_n() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  unbuffered_try_send_n(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_recv_many() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_try_recv_many() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  unbuffered_try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_select_recv() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_select_send() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_coroutine_recv() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_unbuffered_coroutine_send() {
+  auto [tx, rx] = chan::mpmc::unbuffered::channel<int>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_disconnect_sender() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_disconnect_receiver() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_one_item() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  one_item(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_two_seperate() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_two_consecutive() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_leftover() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<std::shared_ptr<int>>(16);
+  leftover(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_try() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  bounded_try(std::move(tx), std::move(rx), 16);
+}
+
+void broadcast_bounded_one_to_one_disconnect_sender() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  one_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_one_to_one_disconnect_sender_buffer_size_1() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(1);
+  one_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_one_to_one_disconnect_receiver() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_send_range() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_send_range_disconnected() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_try_send_n() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void broadcast_bounded_recv_many() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_try_recv_many() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_select_recv() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_select_send() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_coroutine_recv() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_coroutine_send() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(16);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void broadcast_bounded_every_receiver() {
+  auto [tx, rx] = chan::broadcast::bounded::channel<int>(4);
+  auto send_fail = false;
+  auto tx_thread = std::thread([tx = std::move(tx), &send_fail] {
+    for (int i = 0; i < 10000; ++i) {
+      if (!tx.send(i)) {
+        send_fail = true;
+        break;
+      }
+    }
+  });
+
+  std::pair<std::thread, std::vector<int>> rx_threads[10];
+  for (auto &[rx_thread, items] : rx_threads) {
+    rx_thread = std::thread([rx, &items]() mutable {
+      for (auto item : rx) {
+        items.push_back(item);
+      }
+    });
+  }
+  rx.disconnect();
+
+  tx_thread.join();
+  for (auto &[rx_thread, _] : rx_threads) {
+    rx_thread.join();
+  }
+
+  if (send_fail) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+
+  for (auto &[_, items] : rx_threads) {
+    if (items.size() != 10000) {
+      std::ostringstream os;
+      os << "expected 10000 items but got " << items.size();
+      throw std::runtime_error(std::move(os).str());
+    }
+    for (int i = 0; i < 10000; ++i) {
+      if (items[i] != i) {
+        std::ostringstream os;
+        os << "wrong item at position " << i << ": expected " << i << " got "
+           << items[i];
+        throw std::runtime_error(std::move(os).str());
+      }
+    }
+  }
+}
+
+void broadcast_bounded_copy_receiver() {
+  auto [tx, rx1] = chan::broadcast::bounded::channel<int>(16);
+  for (int i = 0; i < 3; ++i) {
+    if (!tx.send(i)) {
+      throw std::runtime_error("send failed when it should not have");
+    }
+  }
+  if (auto item = rx1.recv(); !item || *item != 0) {
+    throw std::runtime_error("first receiver did not get item 0");
+  }
+
+  auto rx2 = rx1;
+  for (auto *rx : {&rx1, &rx2}) {
+    for (int i = 1; i < 3; ++i) {
+      auto item = rx->try_recv();
+      if (!item || *item != i) {
+        std::ostringstream os;
+        os << "expected receiver copy to get item " << i;
+        throw std::runtime_error(std::move(os).str());
+      }
+    }
+    if (rx->try_recv()) {
+      throw std::runtime_error("expected try_recv to fail but it succeeded");
+    }
+  }
+}
+
+void broadcast_bounded_slowest_receiver() {
+  auto [tx, fast_rx] = chan::broadcast::bounded::channel<std::string>(2);
+  auto slow_rx = fast_rx;
+  for (int i = 0; i < 4; ++i) {
+    if (!tx.try_send(std::to_string(i))) {
+      std::ostringstream os;
+      os << "try_send of item " << i << " failed when it should not have";
+      throw std::runtime_error(std::move(os).str());
+    }
+    if (fast_rx.recv() != std::to_string(i)) {
+      throw std::runtime_error("fast receiver got the wrong item");
+    }
+    if (i == 1) {
+      auto result = tx.try_send("full");
+      if (result || !result.error().is_full()) {
+        throw std::runtime_error(
+            "expected try_send to fail with \"full\" while the slow receiver "
+            "is behind");
+      }
+      if (slow_rx.recv() != "0" || slow_rx.recv() != "1") {
+        throw std::runtime_error("slow receiver got the wrong items");
+      }
+    }
+  }
+
+  // Disconnecting the slow receiver frees its slots for the sender.
+  slow_rx.disconnect();
+  for (int i = 4; i < 6; ++i) {
+    if (!tx.try_send(std::to_string(i))) {
+      throw std::runtime_error("try_send failed when it should not have");
+    }
+  }
+}
+
+void broadcast_bounded_peek() {
+  auto [tx, rx1] =
+      chan::broadcast::bounded::channel<std::unique_ptr<int>>(2);
+  auto rx2 = rx1;
+  for (int i = 0; i < 2; ++i) {
+    if (!tx.send(std::make_unique<int>(i))) {
+      throw std::runtime_error("send failed when it should not have");
+    }
+  }
+
+  auto view1 = rx1.peek();
+  auto view2 = rx2.try_peek();
+  if (!view1 || !view2 || **view1 == nullptr || ***view1 != 0) {
+    throw std::runtime_error("expected both receivers to peek item 0");
+  }
+  if (view1->get() != view2->get()) {
+    throw std::runtime_error("expected both receivers to read the same item");
+  }
+
+  // Item 0's slot is not free until both receivers move past it.
+  view1->release();
+  if (auto result = tx.try_send(std::make_unique<int>(2));
+      result || !result.error().is_full()) {
+    throw std::runtime_error(
+        "expected try_send to fail with \"full\" while a view is held");
+  }
+  view2->release();
+  if (!tx.try_send(std::make_unique<int>(2))) {
+    throw std::runtime_error("try_send failed when it should not have");
+  }
+  tx.disconnect();
+
+  for (auto *rx : {&rx1, &rx2}) {
+    for (int i = 1; i < 3; ++i) {
+      auto view = rx->peek();
+      if (!view || ***view != i) {
+        std::ostringstream os;
+        os << "expected to peek item " << i;
+        throw std::runtime_error(std::move(os).str());
+      }
+    }
+    if (auto result = rx->try_peek();
+        result || !result.error().is_disconnected() || rx->peek()) {
+      throw std::runtime_error(
+          "expected peek to fail with \"disconnected\" after the last item");
+    }
+  }
+}
+
+template <typename S, typename R> void overwriting_drop_oldest(S tx, R rx) {
+  for (int i = 0; i < 10; ++i) {
+    if (!tx.send(i)) {
+      throw std::runtime_error("send failed when it should not have");
+    }
+  }
+
+  if (rx.channel_size() != 4) {
+    std::ostringstream os;
+    os << "expected channel size to be 4 but it is " << rx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  if (auto dropped = rx.take_dropped_count(); dropped != 6) {
+    std::ostringstream os;
+    os << "expected 6 dropped items but got " << dropped;
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  for (int i = 6; i < 10; ++i) {
+    auto item = rx.try_recv();
+    if (!item || *item != i) {
+      std::ostringstream os;
+      os << "expected try_recv to receive " << i;
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+
+  if (auto item = rx.try_recv(); item || !item.error().is_empty()) {
+    throw std::runtime_error("expected try_recv error to be \"empty\"");
+  }
+
+  if (auto dropped = rx.take_dropped_count(); dropped != 0) {
+    std::ostringstream os;
+    os << "expected the dropped count to be reset but it is " << dropped;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+template <typename S, typename R>
+void overwriting_many_to_one(S tx, R rx, int sender_count) {
+  constexpr int ITEM_COUNT = 100000;
+  auto send_items = [](S tx, int sender) {
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+      tx.send(sender * ITEM_COUNT + i);
+    }
+  };
+  std::vector<std::thread> senders;
+  if constexpr (std::copyable<S>) {
+    for (int sender = 1; sender < sender_count; ++sender) {
+      senders.emplace_back(send_items, S(tx), sender);
+    }
+  }
+  senders.emplace_back(send_items, std::move(tx), 0);
+
+  // Items from each sender must arrive in order, even with gaps.
+  std::vector<int> last(sender_count, -1);
+  std::size_t received = 0;
+  while (auto item = rx.recv()) {
+    auto sender = *item / ITEM_COUNT;
+    if (*item % ITEM_COUNT <= last[sender]) {
+      std::ostringstream os;
+      os << "item " << *item << " received after " << last[sender];
+      throw std::runtime_error(std::move(os).str());
+    }
+    last[sender] = *item % ITEM_COUNT;
+    ++received;
+  }
+  for (auto &sender : senders) {
+    sender.join();
+  }
+
+  auto dropped = rx.take_dropped_count();
+  if (received + dropped != std::size_t(sender_count) * ITEM_COUNT) {
+    std::ostringstream os;
+    os << "received " << received << " items and dropped " << dropped
+       << " but " << sender_count * ITEM_COUNT << " were sent";
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+void spsc_overwriting_disconnect_sender() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_disconnect_receiver() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_one_item() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  one_item(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_two_seperate() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_two_consecutive() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_leftover() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<std::unique_ptr<int>>(16);
+  leftover(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_leftover_dropped() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<std::unique_ptr<int>>(4);
+  leftover(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_send_range() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(1024);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_send_range_disconnected() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_recv_many() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(1024);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_try_recv_many() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_select_recv() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_select_send() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_coroutine_recv() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(1024);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_coroutine_send() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(1024);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_drop_oldest() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(4);
+  overwriting_drop_oldest(std::move(tx), std::move(rx));
+}
+
+void spsc_overwriting_one_to_one() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(16);
+  overwriting_many_to_one(std::move(tx), std::move(rx), 1);
+}
+
+void spsc_overwriting_one_to_one_buffer_size_1() {
+  auto [tx, rx] = chan::spsc::overwriting::channel<int>(1);
+  overwriting_many_to_one(std::move(tx), std::move(rx), 1);
+}
+
+void mpsc_overwriting_disconnect_sender() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_disconnect_receiver() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_one_item() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  one_item(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_two_seperate() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_two_consecutive() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_leftover() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<std::unique_ptr<int>>(16);
+  leftover(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_leftover_dropped() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<std::unique_ptr<int>>(4);
+  leftover(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_send_range() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(1024);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_send_range_disconnected() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_recv_many() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(1024);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_try_recv_many() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_select_recv() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_select_send() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_coroutine_recv() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(1024);
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_coroutine_send() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(1024);
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_drop_oldest() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(4);
+  overwriting_drop_oldest(std::move(tx), std::move(rx));
+}
+
+void mpsc_overwriting_many_to_one() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(16);
+  overwriting_many_to_one(std::move(tx), std::move(rx), 4);
+}
+
+void mpsc_overwriting_many_to_one_buffer_size_1() {
+  auto [tx, rx] = chan::mpsc::overwriting::channel<int>(1);
+  overwriting_many_to_one(std::move(tx), std::move(rx), 4);
+}
+
+void watch_latest() {
+  auto [tx, rx] = chan::watch::channel<std::string>("initial");
+  if (*rx.latest() != "initial") {
+    throw std::runtime_error("wrong initial value");
+  }
+  if (rx.has_changed()) {
+    throw std::runtime_error("expected the initial value to count as seen");
+  }
+  if (auto value = rx.try_recv(); value || !value.error().is_empty()) {
+    throw std::runtime_error("expected try_recv error to be \"empty\"");
+  }
+
+  for (int i = 1; i <= 3; ++i) {
+    if (!tx.send(std::to_string(i))) {
+      throw std::runtime_error("send failed when it should not have");
+    }
+  }
+  if (!rx.has_changed()) {
+    throw std::runtime_error("expected the value to have changed");
+  }
+  if (auto value = rx.try_recv(); !value || **value != "3") {
+    throw std::runtime_error("expected try_recv to skip to the latest value");
+  }
+  if (auto value = rx.try_recv(); value || !value.error().is_empty()) {
+    throw std::runtime_error("expected try_recv error to be \"empty\"");
+  }
+
+  auto rx2 = rx;
+  if (rx2.has_changed()) {
+    throw std::runtime_error("expected a copy to have seen the same values");
+  }
+  auto old_value = rx.latest();
+  tx.send("4");
+  if (*old_value != "3") {
+    throw std::runtime_error("send changed a value that was still in use");
+  }
+  if (!rx.has_changed() || !rx2.has_changed()) {
+    throw std::runtime_error("expected every receiver to see the change");
+  }
+  if (*rx2.latest() != "4" || rx2.has_changed()) {
+    throw std::runtime_error("expected latest to mark the value as seen");
+  }
+}
+
+void watch_disconnect_sender() {
+  auto [tx, rx] = chan::watch::channel<int>(0);
+  tx.send(5);
+  tx.disconnect();
+
+  if (auto value = rx.recv(); !value || **value != 5) {
+    throw std::runtime_error("expected recv to get the last value sent");
+  }
+  if (auto value = rx.recv(); value) {
+    throw std::runtime_error("expected recv to fail but it succeeded");
+  }
+  if (rx.wait_changed()) {
+    throw std::runtime_error("expected wait_changed to fail but it succeeded");
+  }
+  if (auto value = rx.try_recv_for(std::chrono::microseconds(1));
+      value || !value.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected error from try_recv_for to be \"disconnected\"");
+  }
+  if (*rx.latest() != 5) {
+    throw std::runtime_error("expected the last value to stay readable");
+  }
+}
+
+void watch_disconnect_receiver() {
+  auto [tx, rx] = chan::watch::channel<int>(0);
+  auto rx2 = rx;
+  rx.disconnect();
+  if (!tx.send(1)) {
+    throw std::runtime_error("send failed with a receiver left");
+  }
+  rx2.disconnect();
+  auto result = tx.send(7);
+  if (result) {
+    throw std::runtime_error("expected send to fail but it succeeded");
+  }
+  if (result.error().item != 7) {
+    std::ostringstream os;
+    os << "wrong item in send error: expected 7 got " << result.error().item;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+void watch_wait_changed() {
+  auto [tx, rx] = chan::watch::channel<int>(-1);
+  std::pair<std::thread, std::string> rx_threads[8];
+  for (auto &[rx_thread, error] : rx_threads) {
+    rx_thread = std::thread([rx, &error] {
+      auto last = -1;
+      while (rx.wait_changed()) {
+        auto value = *rx.latest();
+        if (value <= last) {
+          std::ostringstream os;
+          os << "value " << value << " received after " << last;
+          error = std::move(os).str();
+          return;
+        }
+        last = value;
+      }
+      if (last != 9999) {
+        std::ostringstream os;
+        os << "expected the last value to be 9999 but it was " << last;
+        error = std::move(os).str();
+      }
+    });
+  }
+  rx.disconnect();
+
+  for (int i = 0; i < 10000; ++i) {
+    tx.send(i);
+  }
+  tx.disconnect();
+
+  for (auto &[rx_thread, _] : rx_threads) {
+    rx_thread.join();
+  }
+  for (auto &[_, error] : rx_threads) {
+    if (!error.empty()) {
+      throw std::runtime_error(error);
+    }
+  }
+}
+
+void watch_select_recv() {
+  auto [tx, rx] = chan::watch::channel<int>(0);
+  std::optional<std::expected<std::shared_ptr<const int>, chan::RecvError>>
+      result;
+  chan::Select select;
+  select.recv(rx, [&](auto value) { result = std::move(value); });
+  if (select.try_wait()) {
+    throw std::runtime_error("expected try_wait to find nothing ready");
+  }
+  std::thread sender([&tx] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tx.send(7);
+  });
+  if (select.wait() != 0 || !result || !*result || ***result != 7) {
+    throw std::runtime_error("wrong value from select");
+  }
+  sender.join();
+}
+
+void oneshot_send_recv() {
+  auto [tx, rx] = chan::oneshot::channel<int>();
+  if (auto item = rx.try_recv(); item || !item.error().is_empty()) {
+    throw std::runtime_error("expected try_recv error to be \"empty\"");
+  }
+  if (!tx.send(7)) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+  if (!tx.is_null()) {
+    throw std::runtime_error("expected send to disconnect the sender");
+  }
+  if (auto item = rx.recv(); !item || *item != 7) {
+    throw std::runtime_error("wrong item from recv");
+  }
+  if (auto item = rx.recv(); item) {
+    throw std::runtime_error("expected a second recv to fail");
+  }
+  if (auto item = rx.try_recv(); item || !item.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_recv error to be \"disconnected\"");
+  }
+}
+
+void oneshot_disconnect_sender() {
+  auto [tx, rx] = chan::oneshot::channel<int>();
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void oneshot_disconnect_receiver() {
+  auto [tx, rx] = chan::oneshot::channel<int>();
+  rx.disconnect();
+  auto result = tx.send(7);
+  if (result) {
+    throw std::runtime_error("expected send to fail but it succeeded");
+  }
+  if (result.error().item != 7) {
+    std::ostringstream os;
+    os << "wrong item in send error: expected 7 got " << result.error().item;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+void oneshot_leftover() {
+  auto [tx, rx] = chan::oneshot::channel<std::unique_ptr<int>>();
+  if (!tx.send(std::make_unique<int>(7))) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+}
+
+void oneshot_timeout() {
+  auto [tx, rx] = chan::oneshot::channel<int>();
+  if (auto item = rx.try_recv_for(std::chrono::milliseconds(1));
+      item || !item.error().is_empty()) {
+    throw std::runtime_error("expected try_recv_for to time out");
+  }
+  std::thread sender([tx = std::move(tx)]() mutable {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    tx.send(7);
+  });
+  auto item = rx.try_recv_until(std::chrono::steady_clock::now() +
+                                std::chrono::seconds(10));
+  sender.join();
+  if (!item || *item != 7) {
+    throw std::runtime_error("wrong item from try_recv_until");
+  }
+}
+
+void oneshot_select_recv() {
+  auto [tx, rx] = chan::oneshot::channel<int>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void oneshot_request_reply() {
+  auto [request_tx, request_rx] =
+      chan::spsc::bounded::channel<chan::oneshot::Sender<int>>(16);
+  std::thread server([request_rx = std::move(request_rx)] {
+    for (int i = 0; auto reply = request_rx.recv(); ++i) {
+      reply->send(i);
+    }
+  });
+
+  for (int i = 0; i < 100000; ++i) {
+    auto [reply_tx, reply_rx] = chan::oneshot::channel<int>();
+    request_tx.send(std::move(reply_tx));
+    if (auto reply = reply_rx.recv(); !reply || *reply != i) {
+      std::ostringstream os;
+      os << "wrong reply to request " << i;
+      request_tx.disconnect();
+      server.join();
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  request_tx.disconnect();
+  server.join();
+}
+
+void oneshot_race() {
+  // Let both sides finish at the same time, so they race to destroy the
+  // channel.
+  for (int i = 0; i < 30000; ++i) {
+    auto [tx, rx] = chan::oneshot::channel<std::unique_ptr<int>>();
+    std::thread sender([tx = std::move(tx), i]() mutable {
+      if (i % 3 == 2) {
+        tx.disconnect();
+      } else {
+        tx.send(std::make_unique<int>(7));
+      }
+    });
+    if (i % 3 == 0) {
+      rx.try_recv();
+    } else if (i % 3 == 2 && rx.recv()) {
+      throw std::runtime_error("recv succeeded with no item sent");
+    }
+    rx.disconnect();
+    sender.join();
+  }
+}
+
+template <typename S, typename R> void priority_order(S tx, R rx) {
+  // Send 0, 1, 2, ... with priority `i % 3`.
+  for (int i = 0; i < 9; ++i) {
+    if (!tx.send(i, i % 3)) {
+      throw std::runtime_error("send failed when it should not have");
+    }
+  }
+
+  if (rx.channel_size() != 9) {
+    std::ostringstream os;
+    os << "expected channel size to be 9 but it is " << rx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  for (int expected : {2, 5, 8, 1, 4}) {
+    auto item = rx.try_recv();
+    if (!item || *item != expected) {
+      std::ostringstream os;
+      os << "expected try_recv to receive " << expected;
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+
+  // A new item of a higher priority goes ahead of the ones left.
+  if (!tx.send(9, 2)) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+
+  std::vector<int> buffer(8);
+  if (auto count = rx.try_recv_many(buffer); !count || *count != 5) {
+    throw std::runtime_error("expected try_recv_many to receive 5 items");
+  }
+  std::vector<int> expected{9, 7, 0, 3, 6};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (buffer[i] != expected[i]) {
+      std::ostringstream os;
+      os << "wrong item from try_recv_many: expected " << expected[i]
+         << " got " << buffer[i];
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+
+  if (auto item = rx.try_recv(); item || !item.error().is_empty()) {
+    throw std::runtime_error("expected try_recv error to be \"empty\"");
+  }
+}
+
+template <typename S, typename R>
+void priority_many_to_one(S tx, R rx, int levels) {
+  constexpr int SENDER_COUNT = 4;
+  constexpr int ITEM_COUNT = 100000;
+  auto send_items = [levels](S tx, int sender) {
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+      tx.send(sender * ITEM_COUNT + i, i % levels);
+    }
+  };
+  std::vector<std::thread> senders;
+  for (int sender = 1; sender < SENDER_COUNT; ++sender) {
+    senders.emplace_back(send_items, S(tx), sender);
+  }
+  senders.emplace_back(send_items, std::move(tx), 0);
+
+  // Items from each sender must arrive in order within each priority.
+  std::vector<int> last(SENDER_COUNT * levels, -1);
+  std::size_t received = 0;
+  while (auto item = rx.recv()) {
+    auto key = *item / ITEM_COUNT * levels + *item % ITEM_COUNT % levels;
+    if (*item % ITEM_COUNT <= last[key]) {
+      std::ostringstream os;
+      os << "item " << *item << " received after " << last[key];
+      throw std::runtime_error(std::move(os).str());
+    }
+    last[key] = *item % ITEM_COUNT;
+    ++received;
+  }
+  for (auto &sender : senders) {
+    sender.join();
+  }
+
+  if (received != std::size_t(SENDER_COUNT) * ITEM_COUNT) {
+    std::ostringstream os;
+    os << "received " << received << " items but "
+       << SENDER_COUNT * ITEM_COUNT << " were sent";
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+void mpsc_priority_disconnect_sender() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_disconnect_receiver() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_two_seperate() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_two_consecutive() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_leftover() {
+  auto [tx, rx] = chan::mpsc::priority::channel<std::unique_ptr<int>, 3>();
+  leftover(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_try() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  unbounded_try(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_many_to_one_disconnect_sender() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  many_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_many_to_one_disconnect_receiver() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  many_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_send_range() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_send_range_disconnected() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_recv_many() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_try_recv_many() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_select_recv() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_select_send() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_coroutine_recv() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_coroutine_send() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_order() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  priority_order(std::move(tx), std::move(rx));
+}
+
+void mpsc_priority_many_to_one_levels_1() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 1>();
+  priority_many_to_one(std::move(tx), std::move(rx), 1);
+}
+
+void mpsc_priority_many_to_one_levels_3() {
+  auto [tx, rx] = chan::mpsc::priority::channel<int, 3>();
+  priority_many_to_one(std::move(tx), std::move(rx), 3);
+}
+
+void mpmc_priority_disconnect_sender() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_disconnect_receiver() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  unbounded_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_two_seperate() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_two_consecutive() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_leftover() {
+  auto [tx, rx] = chan::mpmc::priority::channel<std::unique_ptr<int>, 3>();
+  leftover(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_try() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  unbounded_try(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_many_to_one_disconnect_sender() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  many_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_many_to_one_disconnect_receiver() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  many_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_one_to_many_disconnect_sender() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  one_to_many_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_one_to_many_disconnect_receiver() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  one_to_many_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_many_to_many_disconnect_sender() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  many_to_many_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_many_to_many_disconnect_receiver() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  many_to_many_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_add_remove_sender_receiver() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  add_remove_sender_receiver(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_send_range() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_send_range_disconnected() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_recv_many() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_try_recv_many() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_select_recv() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  select_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_select_send() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  select_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_coroutine_recv() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  coroutine_recv(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_coroutine_send() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  coroutine_send(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_order() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  priority_order(std::move(tx), std::move(rx));
+}
+
+void mpmc_priority_many_to_one_levels_1() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 1>();
+  priority_many_to_one(std::move(tx), std::move(rx), 1);
+}
+
+void mpmc_priority_many_to_one_levels_3() {
+  auto [tx, rx] = chan::mpmc::priority::channel<int, 3>();
+  priority_many_to_one(std::move(tx), std::move(rx), 3);
+}
+
+/// Unique name for a shared memory object used by one test.
+std::string ipc_name() {
+  static int count = 0;
+  return "/chan-test-" + std::to_string(::getpid()) + "-" +
+         std::to_string(count++);
+}
+
+template <typename T> auto spsc_ipc_channel(std::size_t capacity) {
+  auto name = ipc_name();
+  auto rx = chan::spsc::ipc::create_receiver<T>(name, capacity);
+  auto tx = chan::spsc::ipc::connect_sender<T>(name);
+  return std::pair(std::move(tx), std::move(rx));
+}
+
+template <typename T> auto mpsc_ipc_channel(std::size_t capacity) {
+  auto name = ipc_name();
+  auto rx = chan::mpsc::ipc::create_receiver<T>(name, capacity);
+  auto tx = chan::mpsc::ipc::connect_sender<T>(name);
+  return std::pair(std::move(tx), std::move(rx));
+}
+
+template <typename F> void expect_system_error(F f, const char *what) {
+  try {
+    f();
+  } catch (const std::system_error &) {
+    return;
+  }
+  std::ostringstream os;
+  os << "expected a std::system_error when trying to " << what;
+  throw std::runtime_error(std::move(os).str());
+}
+
+struct IpcRecord {
+  int sender;
+  int index;
+  char payload[56];
+};
+
+/// Start `sender_count` child processes that each call `send_items(sender)`.
+template <typename F>
+std::vector<pid_t> fork_senders(int sender_count, F send_items) {
+  std::vector<pid_t> children;
+  for (int sender = 0; sender < sender_count; ++sender) {
+    auto pid = ::fork();
+    if (pid == -1) {
+      throw std::runtime_error("fork failed");
+    }
+    if (pid == 0) {
+      try {
+        ::_exit(send_items(sender) ? 0 : 1);
+      } catch (...) {
+        ::_exit(2);
+      }
+    }
+    children.push_back(pid);
+  }
+  return children;
+}
+
+/// Receive every record from the `children` started by `fork_senders`.
+/// `all_started()` is called once a record from every child has arrived.
+template <typename R, typename F>
+void recv_records(R rx, const std::vector<pid_t> &children, int item_count,
+                  F all_started) {
+  std::vector<int> next(children.size(), 0);
+  std::size_t started = 0;
+  auto wrong = false;
+  while (auto record = rx.recv()) {
+    if (next[record->sender] == 0 && ++started == children.size()) {
+      all_started();
+    }
+    if (record->index != next[record->sender]++ ||
+        record->payload[record->index % 56] != char(record->index)) {
+      wrong = true;
+    }
+  }
+  for (auto pid : children) {
+    int status;
+    if (::waitpid(pid, &status, 0) == -1 || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      throw std::runtime_error("sending process failed");
+    }
+  }
+
+  if (wrong) {
+    throw std::runtime_error("record received out of order or corrupted");
+  }
+  for (std::size_t sender = 0; sender < children.size(); ++sender) {
+    if (next[sender] != item_count) {
+      std::ostringstream os;
+      os << "expected " << item_count << " records from sender " << sender
+         << " but got " << next[sender];
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+}
+
+template <typename S> bool send_records(const S &tx, int sender, int count) {
+  for (int index = 0; index < count; ++index) {
+    IpcRecord record{sender, index, {}};
+    record.payload[index % 56] = char(index);
+    if (!tx.send(record)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void spsc_ipc_disconnect_sender() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_disconnect_receiver() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_one_item() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  one_item(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_two_seperate() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_two_consecutive() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_try() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  bounded_try(std::move(tx), std::move(rx), 16);
+}
+
+void spsc_ipc_one_to_one_disconnect_sender() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  one_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_one_to_one_disconnect_receiver() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_send_range() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_send_range_disconnected() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_try_send_n() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void spsc_ipc_recv_many() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_try_recv_many() {
+  auto [tx, rx] = spsc_ipc_channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void spsc_ipc_connect_errors() {
+  auto name = ipc_name();
+  expect_system_error([&] { chan::spsc::ipc::connect_sender<int>(name); },
+                      "connect to a missing channel");
+  auto rx = chan::spsc::ipc::create_receiver<int>(name, 16);
+  expect_system_error(
+      [&] { chan::spsc::ipc::create_receiver<int>(name, 16); },
+      "create a channel that already exists");
+  expect_system_error(
+      [&] { chan::spsc::ipc::connect_sender<long long>(name); },
+      "connect with a different item type");
+  expect_system_error([&] { chan::mpsc::ipc::connect_sender<int>(name); },
+                      "connect to a different channel variant");
+  auto tx = chan::spsc::ipc::connect_sender<int>(name);
+  expect_system_error([&] { chan::spsc::ipc::connect_sender<int>(name); },
+                      "connect a second sender");
+  rx.disconnect();
+  expect_system_error([&] { chan::spsc::ipc::connect_sender<int>(name); },
+                      "connect after the receiver removed the channel");
+}
+
+void spsc_ipc_between_processes() {
+  constexpr int ITEM_COUNT = 100000;
+  auto name = ipc_name();
+  auto rx = chan::spsc::ipc::create_receiver<IpcRecord>(name, 64);
+  auto children = fork_senders(1, [&](int sender) {
+    auto tx = chan::spsc::ipc::connect_sender<IpcRecord>(name);
+    return send_records(tx, sender, ITEM_COUNT);
+  });
+  recv_records(std::move(rx), children, ITEM_COUNT, [] {});
+}
+
+void mpsc_ipc_disconnect_sender() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_disconnect_receiver() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_one_item() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  one_item(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_two_seperate() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  two_seperate(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_two_consecutive() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  two_consecutive(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_try() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  bounded_try(std::move(tx), std::move(rx), 16);
+}
+
+void mpsc_ipc_one_to_one_disconnect_sender() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  one_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_one_to_one_disconnect_receiver() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  one_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_many_to_one_disconnect_sender() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  many_to_one_disconnect_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_many_to_one_disconnect_receiver() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  many_to_one_disconnect_receiver(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_add_remove_sender() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(1);
+  add_remove_sender(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_send_range() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  send_range(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_send_range_disconnected() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  send_range_disconnected(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_try_send_n() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  bounded_try_send_n(std::move(tx), std::move(rx), 16);
+}
+
+void mpsc_ipc_recv_many() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_try_recv_many() {
+  auto [tx, rx] = mpsc_ipc_channel<int>(16);
+  try_recv_many(std::move(tx), std::move(rx));
+}
+
+void mpsc_ipc_connect_errors() {
+  auto name = ipc_name();
+  expect_system_error([&] { chan::mpsc::ipc::connect_sender<int>(name); },
+                      "connect to a missing channel");
+  auto rx = chan::mpsc::ipc::create_receiver<int>(name, 16);
+  expect_system_error(
+      [&] { chan::mpsc::ipc::connect_sender<long long>(name); },
+      "connect with a different item type");
+  expect_system_error([&] { chan::spsc::ipc::connect_sender<int>(name); },
+                      "connect to a different channel variant");
+  auto tx1 = chan::mpsc::ipc::connect_sender<int>(name);
+  auto tx2 = chan::mpsc::ipc::connect_sender<int>(name);
+  tx1.disconnect();
+  tx2.disconnect();
+  expect_system_error([&] { chan::mpsc::ipc::connect_sender<int>(name); },
+                      "connect after every sender disconnected");
+}
+
+void mpsc_ipc_between_processes() {
+  constexpr int SENDER_COUNT = 4;
+  constexpr int ITEM_COUNT = 50000;
+  auto name = ipc_name();
+  auto rx = chan::mpsc::ipc::create_receiver<IpcRecord>(name, 64);
+  // Connect before forking, so every child inherits a sender to copy.
+  auto tx = chan::mpsc::ipc::connect_sender<IpcRecord>(name);
+  auto children = fork_senders(SENDER_COUNT, [&](int sender) {
+    auto child_tx = tx;
+    return send_records(child_tx, sender, ITEM_COUNT);
+  });
+  // A child counts as a sender once it copies `tx`, so keep `tx` until every
+  // child has sent something.
+  recv_records(std::move(rx), children, ITEM_COUNT, [&] { tx.disconnect(); });
+}
+
+template <typename S, typename R> void reserve_peek(S tx, R rx) {
+  // Several rounds, so the items wrap around bounded buffers and cross chunks
+  // of unbounded ones.
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 10; ++i) {
+      auto slot = tx.reserve();
+      if (!slot) {
+        throw std::runtime_error("reserve failed when it should not have");
+      }
+      ::new (slot->get()) std::string(100, char('a' + i));
+      slot->commit();
+      if (!slot->is_null()) {
+        throw std::runtime_error("expected slot to be null after commit");
+      }
+    }
+
+    if (tx.channel_size() != 10) {
+      std::ostringstream os;
+      os << "expected channel size to be 10 but it is " << tx.channel_size();
+      throw std::runtime_error(std::move(os).str());
+    }
+
+    for (int i = 0; i < 10; ++i) {
+      auto view = rx.peek();
+      if (!view) {
+        throw std::runtime_error("peek failed when it should not have");
+      }
+      if (**view != std::string(100, char('a' + i))) {
+        std::ostringstream os;
+        os << "wrong item from peek: expected " << char('a' + i)
+           << "... got " << (*view)->substr(0, 1) << "...";
+        throw std::runtime_error(std::move(os).str());
+      }
+      // Release half of the items explicitly and the rest by destroying the
+      // view.
+      if (i % 2 == 0) {
+        view->release();
+        if (!view->is_null()) {
+          throw std::runtime_error("expected view to be null after release");
+        }
+      }
+    }
+
+    if (rx.channel_size() != 0) {
+      std::ostringstream os;
+      os << "expected channel size to be 0 but it is " << rx.channel_size();
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+
+  if (!tx.send(std::string("sent"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  tx.disconnect();
+  if (auto view = rx.peek(); !view || **view != "sent") {
+    throw std::runtime_error("expected peek to get an item from send");
+  }
+  if (rx.peek()) {
+    throw std::runtime_error(
+        "expected peek to fail after the sender disconnected");
+  }
+  if (auto result = rx.try_peek();
+      result || !result.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_peek error to be \"disconnected\" but it was not");
+  }
+}
+
+template <typename S, typename R>
+void bounded_try_reserve(S tx, R rx, std::size_t buffer_capacity) {
+  if (auto result = rx.try_peek(); result || !result.error().is_empty()) {
+    throw std::runtime_error(
+        "expected try_peek error to be \"empty\" but it was not");
+  }
+
+  for (int i = 0; i < int(buffer_capacity); ++i) {
+    // Since try_reserve can spuriously return "full", try many times to make
+    // the test consistent.
+    for (int j = 0;; ++j) {
+      if (j == 1000) {
+        throw std::runtime_error("try_reserve failed after 1000 attempts");
+      }
+      auto slot = tx.try_reserve();
+      if (slot) {
+        ::new (slot->get()) std::string(std::to_string(i));
+        slot->commit();
+        break;
+      }
+      if (slot.error().is_disconnected()) {
+        throw std::runtime_error("try_reserve error was \"disconnected\" when "
+                                 "it should have succeeded");
+      }
+    }
+  }
+  if (auto slot = tx.try_reserve(); slot || !slot.error().is_full()) {
+    throw std::runtime_error(
+        "expected try_reserve error to be \"full\" but it was not");
+  }
+
+  for (int i = 0; i < int(buffer_capacity); ++i) {
+    auto view = rx.try_peek();
+    for (int j = 0; !view; ++j) {
+      if (j == 1000) {
+        throw std::runtime_error("try_peek failed after 1000 attempts");
+      }
+      view = rx.try_peek();
+    }
+    if (**view != std::to_string(i)) {
+      std::ostringstream os;
+      os << "wrong item from try_peek: expected " << i << " got " << **view;
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+
+  rx.disconnect();
+  if (auto slot = tx.try_reserve(); slot || !slot.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_reserve error to be \"disconnected\" but it was not");
+  }
+  if (tx.reserve()) {
+    throw std::runtime_error(
+        "expected reserve to fail after the receiver disconnected");
+  }
+}
+
+/// Each sender constructs `{sender, index}` records in place, and the receiver
+/// reads them in place.
+template <typename S, typename R>
+void reserve_peek_threads(std::vector<S> senders, R rx) {
+  constexpr int ITEM_COUNT = 10000;
+
+  std::vector<std::thread> threads;
+  for (int sender = 0; sender < int(senders.size()); ++sender) {
+    threads.emplace_back([tx = std::move(senders[sender]), sender] {
+      for (int index = 0; index < ITEM_COUNT; ++index) {
+        auto slot = tx.reserve();
+        if (!slot) {
+          return;
+        }
+        ::new (slot->get()) std::pair(sender, index);
+        slot->commit();
+      }
+    });
+  }
+
+  std::vector<int> next(senders.size(), 0);
+  auto wrong = false;
+  while (auto view = rx.peek()) {
+    auto [sender, index] = **view;
+    if (index != next[sender]++) {
+      wrong = true;
+    }
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (wrong) {
+    throw std::runtime_error("item received out of order");
+  }
+  for (int sender = 0; sender < int(senders.size()); ++sender) {
+    if (next[sender] != ITEM_COUNT) {
+      std::ostringstream os;
+      os << "expected " << ITEM_COUNT << " items from sender " << sender
+         << " but got " << next[sender];
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+}
+
+template <typename S, typename R> void reserve_abandon(S tx, R rx) {
+  std::string *abandoned;
+  {
+    auto slot = tx.reserve();
+    if (!slot) {
+      throw std::runtime_error("reserve failed when it should not have");
+    }
+    abandoned = slot->get();
+  }
+
+  if (tx.channel_size() != 0) {
+    std::ostringstream os;
+    os << "expected channel size to be 0 but it is " << tx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  auto slot = tx.reserve();
+  if (!slot) {
+    throw std::runtime_error("reserve failed when it should not have");
+  }
+  if (slot->get() != abandoned) {
+    throw std::runtime_error(
+        "expected the abandoned slot to be reserved again");
+  }
+  ::new (slot->get()) std::string("kept");
+  slot->commit();
+  tx.disconnect();
+
+  if (auto item = rx.recv(); !item || *item != "kept") {
+    throw std::runtime_error("expected recv to get the committed item");
+  }
+  if (rx.recv()) {
+    throw std::runtime_error(
+        "expected recv to fail after the sender disconnected");
+  }
+}
+
+/// On mpsc channels, an abandoned slot keeps its place in the order items are
+/// received, and the receiver skips it.
+template <typename S, typename R> void reserve_abandon_skipped(S tx, R rx) {
+  if (!tx.send(std::string("first"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  if (!tx.reserve()) {
+    throw std::runtime_error("reserve failed when it should not have");
+  }
+  if (tx.channel_size() != 1) {
+    std::ostringstream os;
+    os << "expected channel size to be 1 but it is " << tx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (!tx.send(std::string("second"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  for (auto expected : {"first", "second"}) {
+    if (auto item = rx.recv(); !item || *item != expected) {
+      std::ostringstream os;
+      os << "expected recv to get \"" << expected << "\"";
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  if (rx.channel_size() != 0) {
+    std::ostringstream os;
+    os << "expected channel size to be 0 but it is " << rx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (auto item = rx.try_recv(); item || !item.error().is_empty()) {
+    throw std::runtime_error(
+        "expected try_recv error to be \"empty\" but it was not");
+  }
+
+  // Abandoned slot at the head when peeking.
+  if (!tx.reserve()) {
+    throw std::runtime_error("reserve failed when it should not have");
+  }
+  if (!tx.send(std::string("third"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  if (auto view = rx.peek(); !view || **view != "third") {
+    throw std::runtime_error("expected peek to skip the abandoned slot");
+  }
+
+  // Abandoned slot in the middle of a batch.
+  if (!tx.send(std::string("x"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  if (!tx.reserve()) {
+    throw std::runtime_error("reserve failed when it should not have");
+  }
+  if (!tx.send(std::string("y"))) {
+    throw std::runtime_error("sender disconnected when it should not be");
+  }
+  std::vector<std::string> items(3);
+  std::vector<std::string> received;
+  while (received.size() < 2) {
+    auto count = rx.recv_many(items);
+    if (!count) {
+      throw std::runtime_error("recv_many failed when it should not have");
+    }
+    received.insert(received.end(), items.begin(), items.begin() + *count);
+  }
+  if (received != std::vector<std::string>{"x", "y"}) {
+    throw std::runtime_error("expected recv_many to get \"x\" and \"y\"");
+  }
+
+  // Many more abandoned slots than a bounded channel holds.
+  constexpr int ITEM_COUNT = 100;
+  std::thread sender([&] {
+    for (int i = 0; i < ITEM_COUNT; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        tx.reserve();
+      }
+      tx.send(std::to_string(i));
+    }
+    tx.disconnect();
+  });
+  for (int i = 0; i < ITEM_COUNT; ++i) {
+    if (auto item = rx.recv(); !item || *item != std::to_string(i)) {
+      sender.join();
+      std::ostringstream os;
+      os << "expected recv to get \"" << i << "\"";
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  sender.join();
+  if (rx.recv()) {
+    throw std::runtime_error(
+        "expected recv to fail after the sender disconnected");
+  }
+}
+
+void spsc_bounded_reserve_peek() {
+  auto [tx, rx] = chan::spsc::bounded::channel<std::string>(16);
+  reserve_peek(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_try_reserve() {
+  auto [tx, rx] = chan::spsc::bounded::channel<std::string>(16);
+  bounded_try_reserve(std::move(tx), std::move(rx), 16);
+}
+
+void spsc_bounded_reserve_peek_threads() {
+  auto [tx, rx] = chan::spsc::bounded::channel<std::pair<int, int>>(16);
+  std::vector<decltype(tx)> senders;
+  senders.push_back(std::move(tx));
+  reserve_peek_threads(std::move(senders), std::move(rx));
+}
+
+void spsc_bounded_reserve_abandon() {
+  auto [tx, rx] = chan::spsc::bounded::channel<std::string>(16);
+  reserve_abandon(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_reserve_peek() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<std::string, 4>();
+  reserve_peek(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_reserve_peek_threads() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<std::pair<int, int>, 4>();
+  std::vector<decltype(tx)> senders;
+  senders.push_back(std::move(tx));
+  reserve_peek_threads(std::move(senders), std::move(rx));
+}
+
+void spsc_unbounded_reserve_abandon() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<std::string, 4>();
+  reserve_abandon(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_reserve_peek() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<std::string>(16);
+  reserve_peek(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_try_reserve() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<std::string>(16);
+  bounded_try_reserve(std::move(tx), std::move(rx), 16);
+}
+
+void mpsc_bounded_reserve_peek_threads() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<std::pair<int, int>>(16);
+  std::vector senders(4, tx);
+  tx.disconnect();
+  reserve_peek_threads(std::move(senders), std::move(rx));
+}
+
+void mpsc_bounded_reserve_abandon() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<std::string>(4);
+  reserve_abandon_skipped(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_reserve_peek() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<std::string, 4>();
+  reserve_peek(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_reserve_peek_threads() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<std::pair<int, int>, 4>();
+  std::vector senders(4, tx);
+  tx.disconnect();
+  reserve_peek_threads(std::move(senders), std::move(rx));
+}
+
+void mpsc_unbounded_reserve_abandon() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<std::string, 4>();
+  reserve_abandon_skipped(std::move(tx), std::move(rx));
+}
+
+/// Record that counts how many times records are moved, so a test can tell
+/// whether one was constructed in place.
+struct MoveCountedRecord {
+  static inline int moves = 0;
+
+  std::string text;
+  int number;
+
+  explicit MoveCountedRecord(int number) noexcept : number(number) {}
+
+  MoveCountedRecord(std::size_t length, char c) : text(length, c), number(0) {}
+
+  MoveCountedRecord(MoveCountedRecord &&other) noexcept
+      : text(std::move(other.text)), number(other.number) {
+    ++moves;
+  }
+
+  MoveCountedRecord &operator=(MoveCountedRecord &&other) noexcept {
+    this->text = std::move(other.text);
+    this->number = other.number;
+    ++moves;
+    return *this;
+  }
+};
+
+template <typename S, typename R> void emplace_in_place(S tx, R rx) {
+  MoveCountedRecord::moves = 0;
+  for (int i = 0; i < 10; ++i) {
+    if (!tx.emplace(i)) {
+      throw std::runtime_error("emplace failed when it should not have");
+    }
+  }
+  if (MoveCountedRecord::moves != 0) {
+    std::ostringstream os;
+    os << "expected records to be constructed in place but they were moved "
+       << MoveCountedRecord::moves << " times";
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 0; i < 10; ++i) {
+    auto view = rx.peek();
+    if (!view || (*view)->number != i) {
+      throw std::runtime_error("wrong record from emplace");
+    }
+  }
+
+  // A constructor that can throw.
+  MoveCountedRecord::moves = 0;
+  for (int i = 0; i < 10; ++i) {
+    if (!tx.emplace(std::size_t(100), char('a' + i))) {
+      throw std::runtime_error("emplace failed when it should not have");
+    }
+  }
+  if (MoveCountedRecord::moves != 0) {
+    std::ostringstream os;
+    os << "expected records to be constructed in place but they were moved "
+       << MoveCountedRecord::moves << " times";
+    throw std::runtime_error(std::move(os).str());
+  }
+  for (int i = 0; i < 10; ++i) {
+    auto view = rx.peek();
+    if (!view || (*view)->text != std::string(100, char('a' + i))) {
+      throw std::runtime_error("wrong record from emplace");
+    }
+  }
+
+  rx.disconnect();
+  if (tx.emplace(0)) {
+    throw std::runtime_error(
+        "expected emplace to fail after the receiver disconnected");
+  }
+}
+
+template <typename S, typename R> void emplace_throws(S tx, R rx) {
+  if (!tx.emplace(5)) {
+    throw std::runtime_error("emplace failed when it should not have");
+  }
+  try {
+    // Longer than any string can be.
+    tx.emplace(std::string::npos, 'x');
+    throw std::runtime_error("expected constructing the record to throw");
+  } catch (const std::length_error &) {
+  }
+  if (tx.channel_size() != 1) {
+    std::ostringstream os;
+    os << "expected channel size to be 1 but it is " << tx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  if (!tx.emplace(7)) {
+    throw std::runtime_error("emplace failed when it should not have");
+  }
+  tx.disconnect();
+  for (auto number : {5, 7}) {
+    if (auto item = rx.recv(); !item || item->number != number) {
+      std::ostringstream os;
+      os << "expected recv to get the record numbered " << number;
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  if (rx.recv()) {
+    throw std::runtime_error(
+        "expected recv to fail after the sender disconnected");
+  }
+}
+
+template <typename S, typename R>
+void bounded_try_emplace(S tx, R rx, std::size_t buffer_capacity) {
+  for (int i = 0; i < int(buffer_capacity); ++i) {
+    // Since try_emplace can spuriously return "full", try many times to make
+    // the test consistent.
+    for (int j = 0;; ++j) {
+      if (j == 1000) {
+        throw std::runtime_error("try_emplace failed after 1000 attempts");
+      }
+      auto result = tx.try_emplace(i);
+      if (result) {
+        break;
+      }
+      if (result.error().is_disconnected()) {
+        throw std::runtime_error("try_emplace error was \"disconnected\" when "
+                                 "it should have succeeded");
+      }
+    }
+  }
+  if (auto result = tx.try_emplace(-1); result || !result.error().is_full()) {
+    throw std::runtime_error(
+        "expected try_emplace error to be \"full\" but it was not");
+  }
+  if (auto result = tx.try_emplace_for(std::chrono::milliseconds(1), -1);
+      result || !result.error().is_full()) {
+    throw std::runtime_error("expected try_emplace_for to time out");
+  }
+  if (auto result = tx.try_emplace_until(
+          std::chrono::steady_clock::now() + std::chrono::milliseconds(1), -1);
+      result || !result.error().is_full()) {
+    throw std::runtime_error("expected try_emplace_until to time out");
+  }
+
+  // Make room while the sender is blocked.
+  auto make_room = [&] {
+    return std::thread([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      rx.recv();
+    });
+  };
+  auto receiver = make_room();
+  auto sent = tx.try_emplace_for(std::chrono::seconds(10),
+                                 int(buffer_capacity));
+  receiver.join();
+  if (!sent) {
+    throw std::runtime_error("try_emplace_for failed when it should not have");
+  }
+  receiver = make_room();
+  sent = tx.try_emplace_until(
+      std::chrono::steady_clock::now() + std::chrono::seconds(10),
+      int(buffer_capacity) + 1);
+  receiver.join();
+  if (!sent) {
+    throw std::runtime_error(
+        "try_emplace_until failed when it should not have");
+  }
+
+  for (int i = 2; i < int(buffer_capacity) + 2; ++i) {
+    if (auto item = rx.recv(); !item || item->number != i) {
+      throw std::runtime_error("wrong record from try_emplace");
+    }
+  }
+
+  rx.disconnect();
+  if (auto result = tx.try_emplace(0);
+      result || !result.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_emplace error to be \"disconnected\" but it was not");
+  }
+  if (auto result = tx.try_emplace_for(std::chrono::milliseconds(1), 0);
+      result || !result.error().is_disconnected()) {
+    throw std::runtime_error(
+        "expected try_emplace_for error to be \"disconnected\" but it was not");
+  }
+}
+
+void spsc_bounded_emplace_in_place() {
+  auto [tx, rx] = chan::spsc::bounded::channel<MoveCountedRecord>(16);
+  emplace_in_place(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_emplace_throws() {
+  auto [tx, rx] = chan::spsc::bounded::channel<MoveCountedRecord>(16);
+  emplace_throws(std::move(tx), std::move(rx));
+}
+
+void spsc_bounded_try_emplace() {
+  auto [tx, rx] = chan::spsc::bounded::channel<MoveCountedRecord>(16);
+  bounded_try_emplace(std::move(tx), std::move(rx), 16);
+}
+
+void spsc_unbounded_emplace_in_place() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<MoveCountedRecord, 4>();
+  emplace_in_place(std::move(tx), std::move(rx));
+}
+
+void spsc_unbounded_emplace_throws() {
+  auto [tx, rx] = chan::spsc::unbounded::channel<MoveCountedRecord, 4>();
+  emplace_throws(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_emplace_in_place() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<MoveCountedRecord>(16);
+  emplace_in_place(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_emplace_throws() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<MoveCountedRecord>(16);
+  emplace_throws(std::move(tx), std::move(rx));
+}
+
+void mpsc_bounded_try_emplace() {
+  auto [tx, rx] = chan::mpsc::bounded::channel<MoveCountedRecord>(16);
+  bounded_try_emplace(std::move(tx), std::move(rx), 16);
+}
+
+void mpsc_unbounded_emplace_in_place() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<MoveCountedRecord, 4>();
+  emplace_in_place(std::move(tx), std::move(rx));
+}
+
+void mpsc_unbounded_emplace_throws() {
+  auto [tx, rx] = chan::mpsc::unbounded::channel<MoveCountedRecord, 4>();
+  emplace_throws(std::move(tx), std::move(rx));
+}
+
+std::span<const std::byte> as_message(std::string_view text) {
+  return std::as_bytes(std::span(text));
+}
+
+std::string_view as_text(std::span<const std::byte> message) {
+  return {reinterpret_cast<const char *>(message.data()), message.size()};
+}
+
+template <typename S, typename R> void bytes_send_recv(S tx, R rx) {
+  // A few rounds of every size, so messages wrap around the buffer at
+  // different offsets.
+  for (auto round = 0; round < 3; ++round) {
+    for (std::size_t size = 0; size <= tx.max_message_size(); ++size) {
+      std::string text(size, static_cast<char>('a' + size % 26));
+      if (!tx.send(as_message(text))) {
+        throw std::runtime_error("send failed when it should not have");
+      }
+      auto message = rx.recv();
+      if (!message) {
+        throw std::runtime_error("recv failed when it should not have");
+      }
+      if (as_text(**message) != text) {
+        std::ostringstream os;
+        os << "expected \"" << text << "\" but got \"" << as_text(**message)
+           << "\"";
+        throw std::runtime_error(std::move(os).str());
+      }
+    }
+  }
+
+  if (rx.channel_size() != 0) {
+    std::ostringstream os;
+    os << "expected channel size to be 0 but it is " << rx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  if (!tx.send(as_message("first")) || !tx.send(as_message("second"))) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+  tx.disconnect();
+  for (auto text : {"first", "second"}) {
+    auto message = rx.recv();
+    if (!message || as_text(**message) != text) {
+      std::ostringstream os;
+      os << "expected to receive \"" << text
+         << "\" after the sender disconnected";
+      throw std::runtime_error(std::move(os).str());
+    }
+  }
+  if (rx.recv()) {
+    throw std::runtime_error("recv succeeded after the sender disconnected");
+  }
+  if (auto message = rx.try_recv();
+      message || !message.error().is_disconnected()) {
+    throw std::runtime_error("expected try_recv to report a disconnect");
+  }
+}
+
+/// With a 64 byte buffer, each frame is an 8 byte header plus the message
+/// rounded up to 8 bytes, and messages can be up to 24 bytes.
+template <typename S, typename R> void bytes_padding(S tx, R rx) {
+  if (tx.channel_capacity() != 64 || tx.max_message_size() != 24) {
+    std::ostringstream os;
+    os << "expected capacity 64 and max message size 24 but they are "
+       << tx.channel_capacity() << " and " << tx.max_message_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+
+  // Fill the first 56 bytes, then free the first 32.
+  if (!tx.send(as_message(std::string(24, 'a'))) ||
+      !tx.send(as_message(std::string(16, 'b')))) {
+    throw std::runtime_error("send failed when it should not have");
+  }
+  if (auto message = rx.recv(); !message || (*message)->size() != 24) {
+    throw std::runtime_error("expected to receive the first message");
+  }
+
+  // The last 8 bytes are too small, so they become padding and the message
+  // goes to the start of the buffer.
+  if (!tx.try_send(as_message(std::string(16, 'c')))) {
+    throw std::runtime_error("try_send failed when it should not have");
+  }
+  if (tx.channel_size() != 56) {
+    std::ostringstream os;
+    os << "expected channel size to be 56 but it is " << tx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (auto result = tx.try_send(as_message("x")); result) {
+    throw std::runtime_error("try_send succeeded on a full channel");
+  } else if (!result.error().is_full()) {
+    throw std::runtime_error("expected try_send to report a full channel");
+  }
+
+  if (auto message = rx.recv();
+      !message || as_text(**message) != std::string(16, 'b')) {
+    throw std::runtime_error("expected to receive the second message");
+  }
+  auto message = rx.recv();
+  if (!message || as_text(**message) != std::string(16, 'c')) {
+    throw std::runtime_error("expected the message after the padding");
+  }
+  message->release();
+  if (rx.channel_size() != 0) {
+    std::ostringstream os;
+    os << "expected channel size to be 0 but it is " << rx.channel_size();
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+template <typename S, typename R> void bytes_try(S tx, R rx) {
+  if (auto message = rx.try_recv(); message) {
+    throw std::runtime_error("try_recv succeeded on an empty channel");
+  } else if (!message.error().is_empty()) {
+    throw std::runtime_error("expected try_recv to report an empty channel");
+  }
+  if (auto message = rx.try_recv_for(std::chrono::milliseconds(1));
+      message || !message.error().is_empty()) {
+    throw std::runtime_error("expected try_recv_for to time out");
+  }
+
+  std::size_t sent = 0;
+  while (tx.try_send(as_message("12345678"))) {
+    ++sent;
+  }
+  // 64 bytes hold four 16 byte frames.
+  if (sent != 4) {
+    std::ostringstream os;
+    os << "expected to send 4 messages but sent " << sent;
+    throw std::runtime_error(std::move(os).str());
+  }
+  if (auto result =
+          tx.try_send_for(as_message("x"), std::chrono::milliseconds(1));
+      result || !result.error().is_full()) {
+    throw std::runtime_error("expected try_send_for to time out");
+  }
+
+  {
+    auto message = rx.try_recv();
+    if (!message || as_text(**message) != "12345678") {
+      throw std::runtime_error("try_recv failed when it should not have");
+    }
+    // The room isn't freed until the message is released.
+    if (tx.try_send(as_message("x"))) {
+      throw std::runtime_error("try_send succeeded before the release");
+    }
+  }
+  if (!tx.try_send_until(as_message("x"), std::chrono::steady_clock::now() +
+                                              std::chrono::milliseconds(1))) {
+    throw std::runtime_error("try_send_until failed when it should not have");
+  }
+
+  rx.disconnect();
+  if (tx.send(as_message("x"))) {
+    throw std::runtime_error("send succeeded after the receiver disconnected");
+  }
+  if (auto result = tx.try_send(as_message("x"));
+      result || !result.error().is_disconnected()) {
+    throw std::runtime_error("expected try_send to report a disconnect");
+  }
+}
+
+/// Message `index` from sender `id`, followed by `index % 23` bytes of
+/// `index`, so messages have many sizes.
+std::vector<std::byte> numbered_message(int id, int index) {
+  std::vector<std::byte> message(2 * sizeof(int) + index % 23,
+                                 static_cast<std::byte>(index));
+  std::memcpy(message.data(), &id, sizeof(int));
+  std::memcpy(message.data() + sizeof(int), &index, sizeof(int));
+  return message;
+}
+
+template <typename S, typename R>
+void bytes_threads(std::vector<S> senders, R rx) {
+  constexpr auto MESSAGE_COUNT = 5000;
+  std::vector<std::jthread> threads;
+  for (auto id = 0; auto &tx : senders) {
+    threads.emplace_back([tx = std::move(tx), id] {
+      for (auto index = 0; index < MESSAGE_COUNT; ++index) {
+        if (!tx.send(numbered_message(id, index))) {
+          throw std::runtime_error("send failed when it should not have");
+        }
+      }
+    });
+    ++id;
+  }
+
+  std::vector<int> next_index(senders.size(), 0);
+  std::size_t received = 0;
+  while (auto message = rx.recv()) {
+    auto &bytes = **message;
+    int id;
+    int index;
+    std::memcpy(&id, bytes.data(), sizeof(int));
+    std::memcpy(&index, bytes.data() + sizeof(int), sizeof(int));
+    if (!std::ranges::equal(bytes, numbered_message(id, index))) {
+      std::ostringstream os;
+      os << "message " << index << " from sender " << id << " is corrupt";
+      throw std::runtime_error(std::move(os).str());
+    }
+    if (index != next_index[id]) {
+      std::ostringstream os;
+      os << "expected message " << next_index[id] << " from sender " << id
+         << " but got " << index;
+      throw std::runtime_error(std::move(os).str());
+    }
+    ++next_index[id];
+    ++received;
+  }
+
+  if (received != senders.size() * MESSAGE_COUNT) {
+    std::ostringstream os;
+    os << "expected " << senders.size() * MESSAGE_COUNT
+       << " messages but received " << received;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
+void spsc_bytes_send_recv() {
+  auto [tx, rx] = chan::spsc::bytes::channel(128);
+  bytes_send_recv(std::move(tx), std::move(rx));
+}
+
+void spsc_bytes_padding() {
+  auto [tx, rx] = chan::spsc::bytes::channel(64);
+  bytes_padding(std::move(tx), std::move(rx));
+}
+
+void spsc_bytes_try() {
+  auto [tx, rx] = chan::spsc::bytes::channel(64);
+  bytes_try(std::move(tx), std::move(rx));
+}
+
+void spsc_bytes_threads() {
+  auto [tx, rx] = chan::spsc::bytes::channel(256);
+  std::vector<decltype(tx)> senders;
+  senders.push_back(std::move(tx));
+  bytes_threads(std::move(senders), std::move(rx));
+}
+
+void mpsc_bytes_send_recv() {
+  auto [tx, rx] = chan::mpsc::bytes::channel(128);
+  bytes_send_recv(std::move(tx), std::move(rx));
+}
+
+void mpsc_bytes_padding() {
+  auto [tx, rx] = chan::mpsc::bytes::channel(64);
+  bytes_padding(std::move(tx), std::move(rx));
+}
+
+void mpsc_bytes_try() {
+  auto [tx, rx] = chan::mpsc::bytes::channel(64);
+  bytes_try(std::move(tx), std::move(rx));
+}
+
+void mpsc_bytes_threads() {
+  auto [tx, rx] = chan::mpsc::bytes::channel(256);
+  std::vector<decltype(tx)> senders(4, tx);
+  tx.disconnect();
+  bytes_threads(std::move(senders), std::move(rx));
+}
+
+void select_mixed() {
+  auto [bounded_tx, bounded_rx] = chan::mpsc::bounded::channel<int>(4);
+  auto [unbounded_tx, unbounded_rx] = chan::spmc::unbounded::channel<int>();
+  auto [unbuffered_tx, unbuffered_rx] = chan::mpmc::unbuffered::channel<int>();
+  auto feed = [](auto tx) {
+    for (int i = 1; i <= 1000; ++i) {
+      tx.send(i);
+    }
+  };
+  std::thread bounded_sender(feed, std::move(bounded_tx));
+  std::thread unbounded_sender(feed, std::move(unbounded_tx));
+  std::thread unbuffered_sender(feed, std::move(unbuffered_tx));
+
+  int sum = 0;
+  bool done[3] = {false, false, false};
+  auto on_recv = [&](std::size_t channel) {
+    return [&, channel](std::expected<int, chan::RecvError> item) {
+      if (item) {
+        sum += *item;
+      } else {
+        done[channel] = true;
+      }
+    };
+  };
+  chan::Select select;
+  select.recv(bounded_rx, on_recv(0));
+  select.recv(unbounded_rx, on_recv(1));
+  select.recv(unbuffered_rx, on_recv(2));
+  while (!done[0] || !done[1] || !done[2]) {
+    select.wait();
+  }
+  bounded_sender.join();
+  unbounded_sender.join();
+  unbuffered_sender.join();
+  if (sum != 3 * 500500) {
+    std::ostringstream os;
+    os << "wrong sum from select: expected " << 3 * 500500 << " got " << sum;
+    throw std::runtime_error(std::move(os).str());
+  }
+}
+
 struct Test {
   std::string_view name;
   void (*func)();
@@ -2272,6 +5834,19 @@ const Test TESTS[] = {
     Test{"spsc_bounded_one_to_one_disconnect_sender_buffer_size_1", spsc_bounded_one_to_one_disconnect_sender_buffer_size_1},
     Test{"spsc_bounded_one_to_one_disconnect_receiver", spsc_bounded_one_to_one_disconnect_receiver},
     Test{"spsc_bounded_one_to_one_disconnect_receiver_buffer_size_1", spsc_bounded_one_to_one_disconnect_receiver_buffer_size_1},
+    Test{"spsc_bounded_send_range", spsc_bounded_send_range},
+    Test{"spsc_bounded_send_range_buffer_size_1", spsc_bounded_send_range_buffer_size_1},
+    Test{"spsc_bounded_send_range_disconnected", spsc_bounded_send_range_disconnected},
+    Test{"spsc_bounded_try_send_n", spsc_bounded_try_send_n},
+    Test{"spsc_bounded_recv_many", spsc_bounded_recv_many},
+    Test{"spsc_bounded_recv_many_buffer_size_1", spsc_bounded_recv_many_buffer_size_1},
+    Test{"spsc_bounded_try_recv_many", spsc_bounded_try_recv_many},
+    Test{"spsc_bounded_select_recv", spsc_bounded_select_recv},
+    Test{"spsc_bounded_select_send", spsc_bounded_select_send},
+    Test{"spsc_bounded_coroutine_recv", spsc_bounded_coroutine_recv},
+    Test{"spsc_bounded_coroutine_send", spsc_bounded_coroutine_send},
+    Test{"spsc_bounded_two_consecutive_spin", spsc_bounded_two_consecutive_spin},
+    Test{"spsc_bounded_one_to_one_disconnect_sender_spin_yield", spsc_bounded_one_to_one_disconnect_sender_spin_yield},
     Test{"spsc_unbounded_disconnect_sender", spsc_unbounded_disconnect_sender},
     Test{"spsc_unbounded_disconnect_receiver", spsc_unbounded_disconnect_receiver},
     Test{"spsc_unbounded_one_item", spsc_unbounded_one_item},
@@ -2283,11 +5858,34 @@ const Test TESTS[] = {
     Test{"spsc_unbounded_one_to_one_disconnect_sender_chunk_size_1", spsc_unbounded_one_to_one_disconnect_sender_chunk_size_1},
     Test{"spsc_unbounded_one_to_one_disconnect_receiver", spsc_unbounded_one_to_one_disconnect_receiver},
     Test{"spsc_unbounded_one_to_one_disconnect_receiver_chunk_size_1", spsc_unbounded_one_to_one_disconnect_receiver_chunk_size_1},
+    Test{"spsc_unbounded_send_range", spsc_unbounded_send_range},
+    Test{"spsc_unbounded_send_range_chunk_size_1", spsc_unbounded_send_range_chunk_size_1},
+    Test{"spsc_unbounded_send_range_disconnected", spsc_unbounded_send_range_disconnected},
+    Test{"spsc_unbounded_recv_many", spsc_unbounded_recv_many},
+    Test{"spsc_unbounded_recv_many_chunk_size_1", spsc_unbounded_recv_many_chunk_size_1},
+    Test{"spsc_unbounded_try_recv_many", spsc_unbounded_try_recv_many},
+    Test{"spsc_unbounded_shrink_to_fit", spsc_unbounded_shrink_to_fit},
+    Test{"spsc_unbounded_idle_chunk_limit", spsc_unbounded_idle_chunk_limit},
+    Test{"spsc_unbounded_chunks_per_allocation", spsc_unbounded_chunks_per_allocation},
+    Test{"spsc_unbounded_select_recv", spsc_unbounded_select_recv},
+    Test{"spsc_unbounded_select_send", spsc_unbounded_select_send},
+    Test{"spsc_unbounded_coroutine_recv", spsc_unbounded_coroutine_recv},
+    Test{"spsc_unbounded_coroutine_send", spsc_unbounded_coroutine_send},
     Test{"spsc_unbuffered_disconnect_sender", spsc_unbuffered_disconnect_sender},
     Test{"spsc_unbuffered_disconnect_receiver", spsc_unbuffered_disconnect_receiver},
     Test{"spsc_unbuffered_try", spsc_unbuffered_try},
     Test{"spsc_unbuffered_one_to_one_disconnect_sender", spsc_unbuffered_one_to_one_disconnect_sender},
     Test{"spsc_unbuffered_one_to_one_disconnect_receiver", spsc_unbuffered_one_to_one_disconnect_receiver},
+    Test{"spsc_unbuffered_send_range", spsc_unbuffered_send_range},
+    Test{"spsc_unbuffered_send_range_disconnected", spsc_unbuffered_send_range_disconnected},
+    Test{"spsc_unbuffered_try_send_n", spsc_unbuffered_try_send_n},
+    Test{"spsc_unbuffered_recv_many", spsc_unbuffered_recv_many},
+    Test{"spsc_unbuffered_try_recv_many", spsc_unbuffered_try_recv_many},
+    Test{"spsc_unbuffered_select_recv", spsc_unbuffered_select_recv},
+    Test{"spsc_unbuffered_select_send", spsc_unbuffered_select_send},
+    Test{"spsc_unbuffered_coroutine_recv", spsc_unbuffered_coroutine_recv},
+    Test{"spsc_unbuffered_coroutine_send", spsc_unbuffered_coroutine_send},
+    Test{"spsc_unbuffered_try_spin", spsc_unbuffered_try_spin},
     Test{"mpsc_bounded_disconnect_sender", mpsc_bounded_disconnect_sender},
     Test{"mpsc_bounded_disconnect_receiver", mpsc_bounded_disconnect_receiver},
     Test{"mpsc_bounded_one_item", mpsc_bounded_one_item},
@@ -2304,6 +5902,17 @@ const Test TESTS[] = {
     Test{"mpsc_bounded_many_to_one_disconnect_receiver", mpsc_bounded_many_to_one_disconnect_receiver},
     Test{"mpsc_bounded_many_to_one_disconnect_receiver_buffer_size_1", mpsc_bounded_many_to_one_disconnect_receiver_buffer_size_1},
     Test{"mpsc_bounded_add_remove_sender", mpsc_bounded_add_remove_sender},
+    Test{"mpsc_bounded_send_range", mpsc_bounded_send_range},
+    Test{"mpsc_bounded_send_range_buffer_size_1", mpsc_bounded_send_range_buffer_size_1},
+    Test{"mpsc_bounded_send_range_disconnected", mpsc_bounded_send_range_disconnected},
+    Test{"mpsc_bounded_try_send_n", mpsc_bounded_try_send_n},
+    Test{"mpsc_bounded_recv_many", mpsc_bounded_recv_many},
+    Test{"mpsc_bounded_recv_many_buffer_size_1", mpsc_bounded_recv_many_buffer_size_1},
+    Test{"mpsc_bounded_try_recv_many", mpsc_bounded_try_recv_many},
+    Test{"mpsc_bounded_select_recv", mpsc_bounded_select_recv},
+    Test{"mpsc_bounded_select_send", mpsc_bounded_select_send},
+    Test{"mpsc_bounded_coroutine_recv", mpsc_bounded_coroutine_recv},
+    Test{"mpsc_bounded_coroutine_send", mpsc_bounded_coroutine_send},
     Test{"mpsc_unbounded_disconnect_sender", mpsc_unbounded_disconnect_sender},
     Test{"mpsc_unbounded_disconnect_receiver", mpsc_unbounded_disconnect_receiver},
     Test{"mpsc_unbounded_one_item", mpsc_unbounded_one_item},
@@ -2320,6 +5929,20 @@ const Test TESTS[] = {
     Test{"mpsc_unbounded_many_to_one_disconnect_receiver", mpsc_unbounded_many_to_one_disconnect_receiver},
     Test{"mpsc_unbounded_many_to_one_disconnect_receiver_chunk_size_1", mpsc_unbounded_many_to_one_disconnect_receiver_chunk_size_1},
     Test{"mpsc_unbounded_add_remove_sender", mpsc_unbounded_add_remove_sender},
+    Test{"mpsc_unbounded_send_range", mpsc_unbounded_send_range},
+    Test{"mpsc_unbounded_send_range_chunk_size_1", mpsc_unbounded_send_range_chunk_size_1},
+    Test{"mpsc_unbounded_send_range_disconnected", mpsc_unbounded_send_range_disconnected},
+    Test{"mpsc_unbounded_recv_many", mpsc_unbounded_recv_many},
+    Test{"mpsc_unbounded_recv_many_chunk_size_1", mpsc_unbounded_recv_many_chunk_size_1},
+    Test{"mpsc_unbounded_try_recv_many", mpsc_unbounded_try_recv_many},
+    Test{"mpsc_unbounded_shrink_to_fit", mpsc_unbounded_shrink_to_fit},
+    Test{"mpsc_unbounded_idle_chunk_limit", mpsc_unbounded_idle_chunk_limit},
+    Test{"mpsc_unbounded_chunks_per_allocation", mpsc_unbounded_chunks_per_allocation},
+    Test{"mpsc_unbounded_select_recv", mpsc_unbounded_select_recv},
+    Test{"mpsc_unbounded_select_send", mpsc_unbounded_select_send},
+    Test{"mpsc_unbounded_coroutine_recv", mpsc_unbounded_coroutine_recv},
+    Test{"mpsc_unbounded_coroutine_send", mpsc_unbounded_coroutine_send},
+    Test{"mpsc_unbounded_many_to_one_disconnect_sender_spin_yield", mpsc_unbounded_many_to_one_disconnect_sender_spin_yield},
     Test{"mpsc_unbuffered_disconnect_sender", mpsc_unbuffered_disconnect_sender},
     Test{"mpsc_unbuffered_disconnect_receiver", mpsc_unbuffered_disconnect_receiver},
     Test{"mpsc_unbuffered_try", mpsc_unbuffered_try},
@@ -2328,6 +5951,15 @@ const Test TESTS[] = {
     Test{"mpsc_unbuffered_many_to_one_disconnect_sender", mpsc_unbuffered_many_to_one_disconnect_sender},
     Test{"mpsc_unbuffered_many_to_one_disconnect_receiver", mpsc_unbuffered_many_to_one_disconnect_receiver},
     Test{"mpsc_unbuffered_add_remove_sender", mpsc_unbuffered_add_remove_sender},
+    Test{"mpsc_unbuffered_send_range", mpsc_unbuffered_send_range},
+    Test{"mpsc_unbuffered_send_range_disconnected", mpsc_unbuffered_send_range_disconnected},
+    Test{"mpsc_unbuffered_try_send_n", mpsc_unbuffered_try_send_n},
+    Test{"mpsc_unbuffered_recv_many", mpsc_unbuffered_recv_many},
+    Test{"mpsc_unbuffered_try_recv_many", mpsc_unbuffered_try_recv_many},
+    Test{"mpsc_unbuffered_select_recv", mpsc_unbuffered_select_recv},
+    Test{"mpsc_unbuffered_select_send", mpsc_unbuffered_select_send},
+    Test{"mpsc_unbuffered_coroutine_recv", mpsc_unbuffered_coroutine_recv},
+    Test{"mpsc_unbuffered_coroutine_send", mpsc_unbuffered_coroutine_send},
     Test{"spmc_bounded_disconnect_sender", spmc_bounded_disconnect_sender},
     Test{"spmc_bounded_disconnect_receiver", spmc_bounded_disconnect_receiver},
     Test{"spmc_bounded_one_item", spmc_bounded_one_item},
@@ -2344,6 +5976,17 @@ const Test TESTS[] = {
     Test{"spmc_bounded_one_to_many_disconnect_receiver", spmc_bounded_one_to_many_disconnect_receiver},
     Test{"spmc_bounded_one_to_many_disconnect_receiver_buffer_size_1", spmc_bounded_one_to_many_disconnect_receiver_buffer_size_1},
     Test{"spmc_bounded_add_remove_receiver", spmc_bounded_add_remove_receiver},
+    Test{"spmc_bounded_send_range", spmc_bounded_send_range},
+    Test{"spmc_bounded_send_range_buffer_size_1", spmc_bounded_send_range_buffer_size_1},
+    Test{"spmc_bounded_send_range_disconnected", spmc_bounded_send_range_disconnected},
+    Test{"spmc_bounded_try_send_n", spmc_bounded_try_send_n},
+    Test{"spmc_bounded_recv_many", spmc_bounded_recv_many},
+    Test{"spmc_bounded_recv_many_buffer_size_1", spmc_bounded_recv_many_buffer_size_1},
+    Test{"spmc_bounded_try_recv_many", spmc_bounded_try_recv_many},
+    Test{"spmc_bounded_select_recv", spmc_bounded_select_recv},
+    Test{"spmc_bounded_select_send", spmc_bounded_select_send},
+    Test{"spmc_bounded_coroutine_recv", spmc_bounded_coroutine_recv},
+    Test{"spmc_bounded_coroutine_send", spmc_bounded_coroutine_send},
     Test{"spmc_unbounded_disconnect_sender", spmc_unbounded_disconnect_sender},
     Test{"spmc_unbounded_disconnect_receiver", spmc_unbounded_disconnect_receiver},
     Test{"spmc_unbounded_one_item", spmc_unbounded_one_item},
@@ -2359,6 +6002,19 @@ const Test TESTS[] = {
     Test{"spmc_unbounded_one_to_many_disconnect_receiver", spmc_unbounded_one_to_many_disconnect_receiver},
     Test{"spmc_unbounded_one_to_many_disconnect_receiver_chunk_size_1", spmc_unbounded_one_to_many_disconnect_receiver_chunk_size_1},
     Test{"spmc_unbounded_add_remove_receiver", spmc_unbounded_add_remove_receiver},
+    Test{"spmc_unbounded_send_range", spmc_unbounded_send_range},
+    Test{"spmc_unbounded_send_range_chunk_size_1", spmc_unbounded_send_range_chunk_size_1},
+    Test{"spmc_unbounded_send_range_disconnected", spmc_unbounded_send_range_disconnected},
+    Test{"spmc_unbounded_recv_many", spmc_unbounded_recv_many},
+    Test{"spmc_unbounded_recv_many_chunk_size_1", spmc_unbounded_recv_many_chunk_size_1},
+    Test{"spmc_unbounded_try_recv_many", spmc_unbounded_try_recv_many},
+    Test{"spmc_unbounded_shrink_to_fit", spmc_unbounded_shrink_to_fit},
+    Test{"spmc_unbounded_idle_chunk_limit", spmc_unbounded_idle_chunk_limit},
+    Test{"spmc_unbounded_chunks_per_allocation", spmc_unbounded_chunks_per_allocation},
+    Test{"spmc_unbounded_select_recv", spmc_unbounded_select_recv},
+    Test{"spmc_unbounded_select_send", spmc_unbounded_select_send},
+    Test{"spmc_unbounded_coroutine_recv", spmc_unbounded_coroutine_recv},
+    Test{"spmc_unbounded_coroutine_send", spmc_unbounded_coroutine_send},
     Test{"spmc_unbuffered_disconnect_sender", spmc_unbuffered_disconnect_sender},
     Test{"spmc_unbuffered_disconnect_receiver", spmc_unbuffered_disconnect_receiver},
     Test{"spmc_unbuffered_try", spmc_unbuffered_try},
@@ -2367,6 +6023,16 @@ const Test TESTS[] = {
     Test{"spmc_unbuffered_one_to_many_disconnect_sender", spmc_unbuffered_one_to_many_disconnect_sender},
     Test{"spmc_unbuffered_one_to_many_disconnect_receiver", spmc_unbuffered_one_to_many_disconnect_receiver},
     Test{"spmc_unbuffered_add_remove_receiver", spmc_unbuffered_add_remove_receiver},
+    Test{"spmc_unbuffered_send_range", spmc_unbuffered_send_range},
+    Test{"spmc_unbuffered_send_range_disconnected", spmc_unbuffered_send_range_disconnected},
+    Test{"spmc_unbuffered_try_send_n", spmc_unbuffered_try_send_n},
+    Test{"spmc_unbuffered_recv_many", spmc_unbuffered_recv_many},
+    Test{"spmc_unbuffered_try_recv_many", spmc_unbuffered_try_recv_many},
+    Test{"spmc_unbuffered_select_recv", spmc_unbuffered_select_recv},
+    Test{"spmc_unbuffered_select_send", spmc_unbuffered_select_send},
+    Test{"spmc_unbuffered_coroutine_recv", spmc_unbuffered_coroutine_recv},
+    Test{"spmc_unbuffered_coroutine_send", spmc_unbuffered_coroutine_send},
+    Test{"spmc_unbuffered_one_to_many_disconnect_sender_spin_park", spmc_unbuffered_one_to_many_disconnect_sender_spin_park},
     Test{"mpmc_bounded_disconnect_sender", mpmc_bounded_disconnect_sender},
     Test{"mpmc_bounded_disconnect_receiver", mpmc_bounded_disconnect_receiver},
     Test{"mpmc_bounded_one_item", mpmc_bounded_one_item},
@@ -2393,6 +6059,19 @@ const Test TESTS[] = {
     Test{"mpmc_bounded_add_remove_sender", mpmc_bounded_add_remove_sender},
     Test{"mpmc_bounded_add_remove_receiver", mpmc_bounded_add_remove_receiver},
     Test{"mpmc_bounded_add_remove_sender_receiver", mpmc_bounded_add_remove_sender_receiver},
+    Test{"mpmc_bounded_send_range", mpmc_bounded_send_range},
+    Test{"mpmc_bounded_send_range_buffer_size_1", mpmc_bounded_send_range_buffer_size_1},
+    Test{"mpmc_bounded_send_range_disconnected", mpmc_bounded_send_range_disconnected},
+    Test{"mpmc_bounded_try_send_n", mpmc_bounded_try_send_n},
+    Test{"mpmc_bounded_recv_many", mpmc_bounded_recv_many},
+    Test{"mpmc_bounded_recv_many_buffer_size_1", mpmc_bounded_recv_many_buffer_size_1},
+    Test{"mpmc_bounded_try_recv_many", mpmc_bounded_try_recv_many},
+    Test{"mpmc_bounded_select_recv", mpmc_bounded_select_recv},
+    Test{"mpmc_bounded_select_send", mpmc_bounded_select_send},
+    Test{"mpmc_bounded_coroutine_recv", mpmc_bounded_coroutine_recv},
+    Test{"mpmc_bounded_coroutine_send", mpmc_bounded_coroutine_send},
+    Test{"mpmc_bounded_many_to_many_disconnect_sender_spin_park", mpmc_bounded_many_to_many_disconnect_sender_spin_park},
+    Test{"mpmc_bounded_try_spin", mpmc_bounded_try_spin},
     Test{"mpmc_unbounded_disconnect_sender", mpmc_unbounded_disconnect_sender},
     Test{"mpmc_unbounded_disconnect_receiver", mpmc_unbounded_disconnect_receiver},
     Test{"mpmc_unbounded_one_item", mpmc_unbounded_one_item},
@@ -2418,6 +6097,19 @@ const Test TESTS[] = {
     Test{"mpmc_unbounded_add_remove_sender", mpmc_unbounded_add_remove_sender},
     Test{"mpmc_unbounded_add_remove_receiver", mpmc_unbounded_add_remove_receiver},
     Test{"mpmc_unbounded_add_remove_sender_receiver", mpmc_unbounded_add_remove_sender_receiver},
+    Test{"mpmc_unbounded_send_range", mpmc_unbounded_send_range},
+    Test{"mpmc_unbounded_send_range_chunk_size_1", mpmc_unbounded_send_range_chunk_size_1},
+    Test{"mpmc_unbounded_send_range_disconnected", mpmc_unbounded_send_range_disconnected},
+    Test{"mpmc_unbounded_recv_many", mpmc_unbounded_recv_many},
+    Test{"mpmc_unbounded_recv_many_chunk_size_1", mpmc_unbounded_recv_many_chunk_size_1},
+    Test{"mpmc_unbounded_try_recv_many", mpmc_unbounded_try_recv_many},
+    Test{"mpmc_unbounded_shrink_to_fit", mpmc_unbounded_shrink_to_fit},
+    Test{"mpmc_unbounded_idle_chunk_limit", mpmc_unbounded_idle_chunk_limit},
+    Test{"mpmc_unbounded_chunks_per_allocation", mpmc_unbounded_chunks_per_allocation},
+    Test{"mpmc_unbounded_select_recv", mpmc_unbounded_select_recv},
+    Test{"mpmc_unbounded_select_send", mpmc_unbounded_select_send},
+    Test{"mpmc_unbounded_coroutine_recv", mpmc_unbounded_coroutine_recv},
+    Test{"mpmc_unbounded_coroutine_send", mpmc_unbounded_coroutine_send},
     Test{"mpmc_unbuffered_disconnect_sender", mpmc_unbuffered_disconnect_sender},
     Test{"mpmc_unbuffered_disconnect_receiver", mpmc_unbuffered_disconnect_receiver},
     Test{"mpmc_unbuffered_try", mpmc_unbuffered_try},
@@ -2432,6 +6124,213 @@ const Test TESTS[] = {
     Test{"mpmc_unbuffered_add_remove_sender", mpmc_unbuffered_add_remove_sender},
     Test{"mpmc_unbuffered_add_remove_receiver", mpmc_unbuffered_add_remove_receiver},
     Test{"mpmc_unbuffered_add_remove_sender_receiver", mpmc_unbuffered_add_remove_sender_receiver},
+    Test{"mpmc_unbuffered_send_range", mpmc_unbuffered_send_range},
+    Test{"mpmc_unbuffered_send_range_disconnected", mpmc_unbuffered_send_range_disconnected},
+    Test{"mpmc_unbuffered_try_send_n", mpmc_unbuffered_try_send_n},
+    Test{"mpmc_unbuffered_recv_many", mpmc_unbuffered_recv_many},
+    Test{"mpmc_unbuffered_try_recv_many", mpmc_unbuffered_try_recv_many},
+    Test{"mpmc_unbuffered_select_recv", mpmc_unbuffered_select_recv},
+    Test{"mpmc_unbuffered_select_send", mpmc_unbuffered_select_send},
+    Test{"mpmc_unbuffered_coroutine_recv", mpmc_unbuffered_coroutine_recv},
+    Test{"mpmc_unbuffered_coroutine_send", mpmc_unbuffered_coroutine_send},
+    Test{"broadcast_bounded_disconnect_sender", broadcast_bounded_disconnect_sender},
+    Test{"broadcast_bounded_disconnect_receiver", broadcast_bounded_disconnect_receiver},
+    Test{"broadcast_bounded_one_item", broadcast_bounded_one_item},
+    Test{"broadcast_bounded_two_seperate", broadcast_bounded_two_seperate},
+    Test{"broadcast_bounded_two_consecutive", broadcast_bounded_two_consecutive},
+    Test{"broadcast_bounded_leftover", broadcast_bounded_leftover},
+    Test{"broadcast_bounded_try", broadcast_bounded_try},
+    Test{"broadcast_bounded_one_to_one_disconnect_sender", broadcast_bounded_one_to_one_disconnect_sender},
+    Test{"broadcast_bounded_one_to_one_disconnect_sender_buffer_size_1", broadcast_bounded_one_to_one_disconnect_sender_buffer_size_1},
+    Test{"broadcast_bounded_one_to_one_disconnect_receiver", broadcast_bounded_one_to_one_disconnect_receiver},
+    Test{"broadcast_bounded_send_range", broadcast_bounded_send_range},
+    Test{"broadcast_bounded_send_range_disconnected", broadcast_bounded_send_range_disconnected},
+    Test{"broadcast_bounded_try_send_n", broadcast_bounded_try_send_n},
+    Test{"broadcast_bounded_recv_many", broadcast_bounded_recv_many},
+    Test{"broadcast_bounded_try_recv_many", broadcast_bounded_try_recv_many},
+    Test{"broadcast_bounded_select_recv", broadcast_bounded_select_recv},
+    Test{"broadcast_bounded_select_send", broadcast_bounded_select_send},
+    Test{"broadcast_bounded_coroutine_recv", broadcast_bounded_coroutine_recv},
+    Test{"broadcast_bounded_coroutine_send", broadcast_bounded_coroutine_send},
+    Test{"broadcast_bounded_every_receiver", broadcast_bounded_every_receiver},
+    Test{"broadcast_bounded_copy_receiver", broadcast_bounded_copy_receiver},
+    Test{"broadcast_bounded_slowest_receiver", broadcast_bounded_slowest_receiver},
+    Test{"broadcast_bounded_peek", broadcast_bounded_peek},
+    Test{"spsc_overwriting_disconnect_sender", spsc_overwriting_disconnect_sender},
+    Test{"spsc_overwriting_disconnect_receiver", spsc_overwriting_disconnect_receiver},
+    Test{"spsc_overwriting_one_item", spsc_overwriting_one_item},
+    Test{"spsc_overwriting_two_seperate", spsc_overwriting_two_seperate},
+    Test{"spsc_overwriting_two_consecutive", spsc_overwriting_two_consecutive},
+    Test{"spsc_overwriting_leftover", spsc_overwriting_leftover},
+    Test{"spsc_overwriting_leftover_dropped", spsc_overwriting_leftover_dropped},
+    Test{"spsc_overwriting_send_range", spsc_overwriting_send_range},
+    Test{"spsc_overwriting_send_range_disconnected", spsc_overwriting_send_range_disconnected},
+    Test{"spsc_overwriting_recv_many", spsc_overwriting_recv_many},
+    Test{"spsc_overwriting_try_recv_many", spsc_overwriting_try_recv_many},
+    Test{"spsc_overwriting_select_recv", spsc_overwriting_select_recv},
+    Test{"spsc_overwriting_select_send", spsc_overwriting_select_send},
+    Test{"spsc_overwriting_coroutine_recv", spsc_overwriting_coroutine_recv},
+    Test{"spsc_overwriting_coroutine_send", spsc_overwriting_coroutine_send},
+    Test{"spsc_overwriting_drop_oldest", spsc_overwriting_drop_oldest},
+    Test{"spsc_overwriting_one_to_one", spsc_overwriting_one_to_one},
+    Test{"spsc_overwriting_one_to_one_buffer_size_1", spsc_overwriting_one_to_one_buffer_size_1},
+    Test{"mpsc_overwriting_disconnect_sender", mpsc_overwriting_disconnect_sender},
+    Test{"mpsc_overwriting_disconnect_receiver", mpsc_overwriting_disconnect_receiver},
+    Test{"mpsc_overwriting_one_item", mpsc_overwriting_one_item},
+    Test{"mpsc_overwriting_two_seperate", mpsc_overwriting_two_seperate},
+    Test{"mpsc_overwriting_two_consecutive", mpsc_overwriting_two_consecutive},
+    Test{"mpsc_overwriting_leftover", mpsc_overwriting_leftover},
+    Test{"mpsc_overwriting_leftover_dropped", mpsc_overwriting_leftover_dropped},
+    Test{"mpsc_overwriting_send_range", mpsc_overwriting_send_range},
+    Test{"mpsc_overwriting_send_range_disconnected", mpsc_overwriting_send_range_disconnected},
+    Test{"mpsc_overwriting_recv_many", mpsc_overwriting_recv_many},
+    Test{"mpsc_overwriting_try_recv_many", mpsc_overwriting_try_recv_many},
+    Test{"mpsc_overwriting_select_recv", mpsc_overwriting_select_recv},
+    Test{"mpsc_overwriting_select_send", mpsc_overwriting_select_send},
+    Test{"mpsc_overwriting_coroutine_recv", mpsc_overwriting_coroutine_recv},
+    Test{"mpsc_overwriting_coroutine_send", mpsc_overwriting_coroutine_send},
+    Test{"mpsc_overwriting_drop_oldest", mpsc_overwriting_drop_oldest},
+    Test{"mpsc_overwriting_many_to_one", mpsc_overwriting_many_to_one},
+    Test{"mpsc_overwriting_many_to_one_buffer_size_1", mpsc_overwriting_many_to_one_buffer_size_1},
+    Test{"watch_latest", watch_latest},
+    Test{"watch_disconnect_sender", watch_disconnect_sender},
+    Test{"watch_disconnect_receiver", watch_disconnect_receiver},
+    Test{"watch_wait_changed", watch_wait_changed},
+    Test{"watch_select_recv", watch_select_recv},
+    Test{"oneshot_send_recv", oneshot_send_recv},
+    Test{"oneshot_disconnect_sender", oneshot_disconnect_sender},
+    Test{"oneshot_disconnect_receiver", oneshot_disconnect_receiver},
+    Test{"oneshot_leftover", oneshot_leftover},
+    Test{"oneshot_timeout", oneshot_timeout},
+    Test{"oneshot_select_recv", oneshot_select_recv},
+    Test{"oneshot_request_reply", oneshot_request_reply},
+    Test{"oneshot_race", oneshot_race},
+    Test{"mpsc_priority_disconnect_sender", mpsc_priority_disconnect_sender},
+    Test{"mpsc_priority_disconnect_receiver",
+         mpsc_priority_disconnect_receiver},
+    Test{"mpsc_priority_two_seperate", mpsc_priority_two_seperate},
+    Test{"mpsc_priority_two_consecutive", mpsc_priority_two_consecutive},
+    Test{"mpsc_priority_leftover", mpsc_priority_leftover},
+    Test{"mpsc_priority_try", mpsc_priority_try},
+    Test{"mpsc_priority_many_to_one_disconnect_sender",
+         mpsc_priority_many_to_one_disconnect_sender},
+    Test{"mpsc_priority_many_to_one_disconnect_receiver",
+         mpsc_priority_many_to_one_disconnect_receiver},
+    Test{"mpsc_priority_send_range", mpsc_priority_send_range},
+    Test{"mpsc_priority_send_range_disconnected",
+         mpsc_priority_send_range_disconnected},
+    Test{"mpsc_priority_recv_many", mpsc_priority_recv_many},
+    Test{"mpsc_priority_try_recv_many", mpsc_priority_try_recv_many},
+    Test{"mpsc_priority_select_recv", mpsc_priority_select_recv},
+    Test{"mpsc_priority_select_send", mpsc_priority_select_send},
+    Test{"mpsc_priority_coroutine_recv", mpsc_priority_coroutine_recv},
+    Test{"mpsc_priority_coroutine_send", mpsc_priority_coroutine_send},
+    Test{"mpsc_priority_order", mpsc_priority_order},
+    Test{"mpsc_priority_many_to_one_levels_1",
+         mpsc_priority_many_to_one_levels_1},
+    Test{"mpsc_priority_many_to_one_levels_3",
+         mpsc_priority_many_to_one_levels_3},
+    Test{"mpmc_priority_disconnect_sender", mpmc_priority_disconnect_sender},
+    Test{"mpmc_priority_disconnect_receiver",
+         mpmc_priority_disconnect_receiver},
+    Test{"mpmc_priority_two_seperate", mpmc_priority_two_seperate},
+    Test{"mpmc_priority_two_consecutive", mpmc_priority_two_consecutive},
+    Test{"mpmc_priority_leftover", mpmc_priority_leftover},
+    Test{"mpmc_priority_try", mpmc_priority_try},
+    Test{"mpmc_priority_many_to_one_disconnect_sender",
+         mpmc_priority_many_to_one_disconnect_sender},
+    Test{"mpmc_priority_many_to_one_disconnect_receiver",
+         mpmc_priority_many_to_one_disconnect_receiver},
+    Test{"mpmc_priority_one_to_many_disconnect_sender",
+         mpmc_priority_one_to_many_disconnect_sender},
+    Test{"mpmc_priority_one_to_many_disconnect_receiver",
+         mpmc_priority_one_to_many_disconnect_receiver},
+    Test{"mpmc_priority_many_to_many_disconnect_sender",
+         mpmc_priority_many_to_many_disconnect_sender},
+    Test{"mpmc_priority_many_to_many_disconnect_receiver",
+         mpmc_priority_many_to_many_disconnect_receiver},
+    Test{"mpmc_priority_add_remove_sender_receiver",
+         mpmc_priority_add_remove_sender_receiver},
+    Test{"mpmc_priority_send_range", mpmc_priority_send_range},
+    Test{"mpmc_priority_send_range_disconnected",
+         mpmc_priority_send_range_disconnected},
+    Test{"mpmc_priority_recv_many", mpmc_priority_recv_many},
+    Test{"mpmc_priority_try_recv_many", mpmc_priority_try_recv_many},
+    Test{"mpmc_priority_select_recv", mpmc_priority_select_recv},
+    Test{"mpmc_priority_select_send", mpmc_priority_select_send},
+    Test{"mpmc_priority_coroutine_recv", mpmc_priority_coroutine_recv},
+    Test{"mpmc_priority_coroutine_send", mpmc_priority_coroutine_send},
+    Test{"mpmc_priority_order", mpmc_priority_order},
+    Test{"mpmc_priority_many_to_one_levels_1",
+         mpmc_priority_many_to_one_levels_1},
+    Test{"mpmc_priority_many_to_one_levels_3",
+         mpmc_priority_many_to_one_levels_3},
+    Test{"spsc_ipc_disconnect_sender", spsc_ipc_disconnect_sender},
+    Test{"spsc_ipc_disconnect_receiver", spsc_ipc_disconnect_receiver},
+    Test{"spsc_ipc_one_item", spsc_ipc_one_item},
+    Test{"spsc_ipc_two_seperate", spsc_ipc_two_seperate},
+    Test{"spsc_ipc_two_consecutive", spsc_ipc_two_consecutive},
+    Test{"spsc_ipc_try", spsc_ipc_try},
+    Test{"spsc_ipc_one_to_one_disconnect_sender", spsc_ipc_one_to_one_disconnect_sender},
+    Test{"spsc_ipc_one_to_one_disconnect_receiver", spsc_ipc_one_to_one_disconnect_receiver},
+    Test{"spsc_ipc_send_range", spsc_ipc_send_range},
+    Test{"spsc_ipc_send_range_disconnected", spsc_ipc_send_range_disconnected},
+    Test{"spsc_ipc_try_send_n", spsc_ipc_try_send_n},
+    Test{"spsc_ipc_recv_many", spsc_ipc_recv_many},
+    Test{"spsc_ipc_try_recv_many", spsc_ipc_try_recv_many},
+    Test{"spsc_ipc_connect_errors", spsc_ipc_connect_errors},
+    Test{"spsc_ipc_between_processes", spsc_ipc_between_processes},
+    Test{"mpsc_ipc_disconnect_sender", mpsc_ipc_disconnect_sender},
+    Test{"mpsc_ipc_disconnect_receiver", mpsc_ipc_disconnect_receiver},
+    Test{"mpsc_ipc_one_item", mpsc_ipc_one_item},
+    Test{"mpsc_ipc_two_seperate", mpsc_ipc_two_seperate},
+    Test{"mpsc_ipc_two_consecutive", mpsc_ipc_two_consecutive},
+    Test{"mpsc_ipc_try", mpsc_ipc_try},
+    Test{"mpsc_ipc_one_to_one_disconnect_sender", mpsc_ipc_one_to_one_disconnect_sender},
+    Test{"mpsc_ipc_one_to_one_disconnect_receiver", mpsc_ipc_one_to_one_disconnect_receiver},
+    Test{"mpsc_ipc_many_to_one_disconnect_sender", mpsc_ipc_many_to_one_disconnect_sender},
+    Test{"mpsc_ipc_many_to_one_disconnect_receiver", mpsc_ipc_many_to_one_disconnect_receiver},
+    Test{"mpsc_ipc_add_remove_sender", mpsc_ipc_add_remove_sender},
+    Test{"mpsc_ipc_send_range", mpsc_ipc_send_range},
+    Test{"mpsc_ipc_send_range_disconnected", mpsc_ipc_send_range_disconnected},
+    Test{"mpsc_ipc_try_send_n", mpsc_ipc_try_send_n},
+    Test{"mpsc_ipc_recv_many", mpsc_ipc_recv_many},
+    Test{"mpsc_ipc_try_recv_many", mpsc_ipc_try_recv_many},
+    Test{"mpsc_ipc_connect_errors", mpsc_ipc_connect_errors},
+    Test{"mpsc_ipc_between_processes", mpsc_ipc_between_processes},
+    Test{"spsc_bounded_reserve_peek", spsc_bounded_reserve_peek},
+    Test{"spsc_bounded_try_reserve", spsc_bounded_try_reserve},
+    Test{"spsc_bounded_reserve_peek_threads", spsc_bounded_reserve_peek_threads},
+    Test{"spsc_bounded_reserve_abandon", spsc_bounded_reserve_abandon},
+    Test{"spsc_unbounded_reserve_peek", spsc_unbounded_reserve_peek},
+    Test{"spsc_unbounded_reserve_peek_threads", spsc_unbounded_reserve_peek_threads},
+    Test{"spsc_unbounded_reserve_abandon", spsc_unbounded_reserve_abandon},
+    Test{"mpsc_bounded_reserve_peek", mpsc_bounded_reserve_peek},
+    Test{"mpsc_bounded_try_reserve", mpsc_bounded_try_reserve},
+    Test{"mpsc_bounded_reserve_peek_threads", mpsc_bounded_reserve_peek_threads},
+    Test{"mpsc_bounded_reserve_abandon", mpsc_bounded_reserve_abandon},
+    Test{"mpsc_unbounded_reserve_peek", mpsc_unbounded_reserve_peek},
+    Test{"mpsc_unbounded_reserve_peek_threads", mpsc_unbounded_reserve_peek_threads},
+    Test{"mpsc_unbounded_reserve_abandon", mpsc_unbounded_reserve_abandon},
+    Test{"spsc_bounded_emplace_in_place", spsc_bounded_emplace_in_place},
+    Test{"spsc_bounded_emplace_throws", spsc_bounded_emplace_throws},
+    Test{"spsc_bounded_try_emplace", spsc_bounded_try_emplace},
+    Test{"spsc_unbounded_emplace_in_place", spsc_unbounded_emplace_in_place},
+    Test{"spsc_unbounded_emplace_throws", spsc_unbounded_emplace_throws},
+    Test{"mpsc_bounded_emplace_in_place", mpsc_bounded_emplace_in_place},
+    Test{"mpsc_bounded_emplace_throws", mpsc_bounded_emplace_throws},
+    Test{"mpsc_bounded_try_emplace", mpsc_bounded_try_emplace},
+    Test{"mpsc_unbounded_emplace_in_place", mpsc_unbounded_emplace_in_place},
+    Test{"mpsc_unbounded_emplace_throws", mpsc_unbounded_emplace_throws},
+    Test{"spsc_bytes_send_recv", spsc_bytes_send_recv},
+    Test{"spsc_bytes_padding", spsc_bytes_padding},
+    Test{"spsc_bytes_try", spsc_bytes_try},
+    Test{"spsc_bytes_threads", spsc_bytes_threads},
+    Test{"mpsc_bytes_send_recv", mpsc_bytes_send_recv},
+    Test{"mpsc_bytes_padding", mpsc_bytes_padding},
+    Test{"mpsc_bytes_try", mpsc_bytes_try},
+    Test{"mpsc_bytes_threads", mpsc_bytes_threads},
+    Test{"select_mixed", select_mixed},
 };
 // clang-format on
 